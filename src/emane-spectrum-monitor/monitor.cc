@@ -31,9 +31,13 @@
  */
 
 #include "monitorconfigurationfile.h"
+#include "threadschedule.h"
+#include "processmemory.h"
 
 #include <cstdlib>
 #include <iostream>
+#include <cstring>
+#include <cerrno>
 
 #include <emane/application/logger.h>
 #include <emane/application/nembuilder.h>
@@ -44,6 +48,7 @@
 #include <signal.h>
 #include <getopt.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <fstream>
 #include <map>
 
@@ -85,6 +90,7 @@ int main(int argc, char* argv[])
           {"version" , 0, nullptr, 'v'},
           {"pidfile" , 1, nullptr,  3},
           {"uuidfile", 1, nullptr,  4},
+          {"memorylock", 0, nullptr,  6},
           {"priority", 1, nullptr,  'p'},
           {"config", 1, nullptr,'c'},
           {"nem", 1, nullptr,'n'},
@@ -102,13 +108,50 @@ int main(int argc, char* argv[])
           {"noisemaxmessagepropagation", 1, nullptr, 1},
           {"noisemaxsegmentduration", 1, nullptr, 1},
           {"noisemaxsegmentoffset", 1, nullptr, 1},
+          {"antennagaingrid.accuracysamplerate", 1, nullptr, 1},
+          {"antennagaingrid.enable", 1, nullptr, 1},
+          {"antennagaingrid.resolution", 1, nullptr, 1},
+          {"loadgovernor.enable", 1, nullptr, 1},
+          {"loadgovernor.highwatermark", 1, nullptr, 1},
+          {"loadgovernor.lowwatermark", 1, nullptr, 1},
+          {"loadgovernor.maxlevel", 1, nullptr, 1},
+          {"loadgovernor.recoverycycles", 1, nullptr, 1},
+          {"nakagamivariatepoolsize", 1, nullptr, 1},
+          {"noiserecorderbackend", 1, nullptr, 1},
+          {"noiserecorderhugepages", 1, nullptr, 1},
           {"propagationmodel", 1, nullptr, 1},
           {"systemnoisefigure", 1, nullptr, 1},
           {"timesyncthreshold", 1, nullptr, 1},
           {"spectrumquery.binsize", 1, nullptr, 1},
+          {"spectrumquery.compression", 1, nullptr, 1},
+          {"spectrumquery.compression.dictionary", 1, nullptr, 1},
+          {"spectrumquery.compression.level", 1, nullptr, 1},
+          {"spectrumquery.frequencyblocksize", 1, nullptr, 1},
+          {"spectrumquery.history.endpoint", 1, nullptr, 1},
+          {"spectrumquery.history.maxbins", 1, nullptr, 1},
+          {"spectrumquery.history.maxnoisebins", 1, nullptr, 1},
+          {"spectrumquery.history.maxqueries", 1, nullptr, 1},
+          {"spectrumquery.lastvaluecache.endpoint", 1, nullptr, 1},
+          {"spectrumquery.metadata.enable", 1, nullptr, 1},
+          {"spectrumquery.metadata.refreshinterval", 1, nullptr, 1},
           {"spectrumquery.rate", 1, nullptr, 1},
           {"spectrumquery.publishendpoint", 1, nullptr, 1},
+          {"spectrumquery.publishmode", 1, nullptr, 1},
           {"spectrumquery.recorderfile", 1, nullptr, 1},
+          {"spectrumquery.retention.tiers", 1, nullptr, 1},
+          {"spectrumquery.retention.tiersize", 1, nullptr, 1},
+          {"spectrumquery.shmring.name", 1, nullptr, 1},
+          {"spectrumquery.shmring.size", 1, nullptr, 1},
+          {"spectrumquery.streaming.enable", 1, nullptr, 1},
+          {"spectrumquery.streaming.revisionbins", 1, nullptr, 1},
+          {"spectrumquery.streaming.watermark", 1, nullptr, 1},
+          {"stats.eventtable.maxrowsperrefresh", 1, nullptr, 1},
+          {"stats.eventtable.refreshinterval", 1, nullptr, 1},
+          {"stats.latencyhistogram.enable", 1, nullptr, 1},
+          {"stats.memory.refreshinterval", 1, nullptr, 1},
+          {"threadschedule.main", 1, nullptr, 1},
+          {"threadschedule.nem", 1, nullptr, 1},
+          {"threadschedule.zmq", 1, nullptr, 1},
           {"antennaprofilemanifesturi", 1, nullptr, 5},
           {"controlportendpoint", 1, nullptr, 5},
           {"eventservicedevice", 1, nullptr, 5},
@@ -134,6 +177,7 @@ int main(int argc, char* argv[])
       EMANE::NEMId id{};
       bool bDaemonize{};
       bool bRealtime{};
+      bool bMemoryLock{};
       int  iLogLevel{DEFAULT_LOG_LEVEL};
       int  iPriority{DEFAULT_PRIORITY_LEVEL};
       std::string sLogFile{};
@@ -165,6 +209,8 @@ int main(int argc, char* argv[])
               std::cout<<"  -f, --logfile FILE             Log to a file instead of stdout."<<std::endl;
               std::cout<<"  -l, --loglevel [0,4]           Set initial log level."<<std::endl;
               std::cout<<"                                  default: "<<DEFAULT_LOG_LEVEL<<std::endl;
+              std::cout<<"  --memorylock                   Lock all current and future memory and"<<std::endl;
+              std::cout<<"                                 pre-fault it to avoid page fault latency."<<std::endl;
               std::cout<<"  -n,--nem NEMID                 NEM id of node.[1,65534]."<<std::endl;
               std::cout<<"  --pidfile FILE                 Write application pid to file."<<std::endl;
               std::cout<<"  -p, --priority [0,99]          Set realtime priority level."<<std::endl;
@@ -197,10 +243,52 @@ int main(int argc, char* argv[])
               std::cout<<"Place emulator parameters in </emane-spectrum-monitor/emulator>."<<std::endl;
               std::cout<<std::endl;
               std::cout<<"EMANE monitor config:"<<std::endl;
+              std::cout<<"  --antennagaingrid.accuracysamplerate VALUE default: 100"<<std::endl;
+              std::cout<<"  --antennagaingrid.enable VALUE  default: off"<<std::endl;
+              std::cout<<"  --antennagaingrid.resolution VALUE default: 1.0 degrees"<<std::endl;
+              std::cout<<"  --loadgovernor.enable VALUE     default: off"<<std::endl;
+              std::cout<<"  --loadgovernor.highwatermark VALUE default: 0.8"<<std::endl;
+              std::cout<<"  --loadgovernor.lowwatermark VALUE default: 0.5"<<std::endl;
+              std::cout<<"  --loadgovernor.maxlevel VALUE   default: 3"<<std::endl;
+              std::cout<<"  --loadgovernor.recoverycycles VALUE default: 10"<<std::endl;
+              std::cout<<"  --nakagamivariatepoolsize VALUE default: 4096"<<std::endl;
+              std::cout<<"  --noiserecorderbackend VALUE    default: map"<<std::endl;
+              std::cout<<"                                  [map|matrix|segmenttree]"<<std::endl;
+              std::cout<<"  --noiserecorderhugepages VALUE  default: none"<<std::endl;
+              std::cout<<"                                  [none|transparent|explicit]"<<std::endl;
               std::cout<<"  --spectrumquery.binsize VALUE   default: 10000 microseconds"<<std::endl;
+              std::cout<<"  --spectrumquery.compression VALUE default: none"<<std::endl;
+              std::cout<<"                                  [none|zstd]"<<std::endl;
+              std::cout<<"  --spectrumquery.compression.dictionary VALUE  optional"<<std::endl;
+              std::cout<<"  --spectrumquery.compression.level VALUE default: 3"<<std::endl;
+              std::cout<<"  --spectrumquery.frequencyblocksize VALUE default: 100000000 Hz"<<std::endl;
+              std::cout<<"  --spectrumquery.history.endpoint VALUE  optional"<<std::endl;
+              std::cout<<"  --spectrumquery.history.maxbins VALUE default: 10000"<<std::endl;
+              std::cout<<"  --spectrumquery.history.maxnoisebins VALUE default: 1000000"<<std::endl;
+              std::cout<<"  --spectrumquery.history.maxqueries VALUE default: 16"<<std::endl;
+              std::cout<<"  --spectrumquery.lastvaluecache.endpoint VALUE  optional"<<std::endl;
+              std::cout<<"  --spectrumquery.metadata.enable VALUE default: off"<<std::endl;
+              std::cout<<"  --spectrumquery.metadata.refreshinterval VALUE default: 1000000 microseconds"<<std::endl;
               std::cout<<"  --spectrumquery.publishendpoint VALUE default: 0.0.0.0:8883"<<std::endl;
+              std::cout<<"  --spectrumquery.publishmode VALUE default: single"<<std::endl;
+              std::cout<<"                                  [single|subid|frequencyblock]"<<std::endl;
               std::cout<<"  --spectrumquery.rate VALUE      default: 100000 microseconds"<<std::endl;
               std::cout<<"  --spectrumquery.recorderfile VALUE  optional"<<std::endl;
+              std::cout<<"  --spectrumquery.retention.tiers VALUE default: 3 [1,3]"<<std::endl;
+              std::cout<<"  --spectrumquery.retention.tiersize VALUE default: 0 bytes (disabled)"<<std::endl;
+              std::cout<<"  --spectrumquery.shmring.name VALUE  optional"<<std::endl;
+              std::cout<<"  --spectrumquery.shmring.size VALUE default: 16777216 bytes"<<std::endl;
+              std::cout<<"  --spectrumquery.streaming.enable VALUE default: off"<<std::endl;
+              std::cout<<"  --spectrumquery.streaming.revisionbins VALUE default: 5"<<std::endl;
+              std::cout<<"  --spectrumquery.streaming.watermark VALUE default: 10000 microseconds"<<std::endl;
+              std::cout<<"  --stats.eventtable.maxrowsperrefresh VALUE default: 1000"<<std::endl;
+              std::cout<<"  --stats.eventtable.refreshinterval VALUE default: 0 microseconds"<<std::endl;
+              std::cout<<"  --stats.latencyhistogram.enable VALUE default: off"<<std::endl;
+              std::cout<<"  --stats.memory.refreshinterval VALUE default: 1000000 microseconds"<<std::endl;
+              std::cout<<"  --threadschedule.main VALUE     optional, inherited by emulator threads"<<std::endl;
+              std::cout<<"  --threadschedule.nem VALUE      optional"<<std::endl;
+              std::cout<<"  --threadschedule.zmq VALUE      optional"<<std::endl;
+              std::cout<<"                                  CPULIST[:other|batch|idle|fifo|rr[:PRIORITY]]"<<std::endl;
               std::cout<<std::endl;
               std::cout<<"EMANE Physical Layer config:"<<std::endl;
               std::cout<<"  --bandwidth VALUE **"<<std::endl;
@@ -244,6 +332,10 @@ int main(int argc, char* argv[])
               emuConfigArgs.insert({options[iOptionIndex].name,{optarg}});
               break;
 
+            case 6:
+              bMemoryLock = true;
+              break;
+
             case 'r':
               bRealtime = true;
               break;
@@ -410,6 +502,22 @@ int main(int argc, char* argv[])
         }
 
 
+      // lock after daemonizing, locks are not inherited across fork
+      if(bMemoryLock)
+        {
+          if(mlockall(MCL_CURRENT | MCL_FUTURE))
+            {
+              if(!sLogFile.empty() || !iLogLevel)
+                {
+                  std::cerr<<"unable to lock memory: "<<strerror(errno)<<std::endl;
+                }
+
+              logger.log(EMANE::ABORT_LEVEL,"unable to lock memory: %s",strerror(errno));
+
+              return EXIT_FAILURE;
+            }
+        }
+
       logger.log(EMANE::INFO_LEVEL,"application: %s",ss.str().c_str());
       logger.log(EMANE::INFO_LEVEL,"application uuid: %s",uuidBuf);
 
@@ -423,6 +531,46 @@ int main(int argc, char* argv[])
           phyConfigArgs.insert(item);
         }
 
+      // the main thread schedule is applied before the emulator
+      // creates its threads, which inherit it
+      auto mainThreadScheduleIter = phyConfigArgs.find("threadschedule.main");
+
+      if(mainThreadScheduleIter != phyConfigArgs.end())
+        {
+          EMANE::SpectrumTools::ThreadSchedule schedule{};
+
+          try
+            {
+              schedule =
+                EMANE::SpectrumTools::parseThreadSchedule(mainThreadScheduleIter->second.front());
+            }
+          catch(std::exception & exp)
+            {
+              std::cerr<<exp.what()<<std::endl;
+              return EXIT_FAILURE;
+            }
+
+          if(int iError = EMANE::SpectrumTools::applyThreadSchedule(schedule))
+            {
+              if(!sLogFile.empty() || !iLogLevel)
+                {
+                  std::cerr<<"unable to apply main thread schedule: "<<strerror(iError)<<std::endl;
+                }
+
+              logger.log(EMANE::ABORT_LEVEL,
+                         "unable to apply main thread schedule: %s",
+                         strerror(iError));
+
+              return EXIT_FAILURE;
+            }
+
+          logger.log(EMANE::INFO_LEVEL,
+                     "main thread schedule: %s",
+                     EMANE::SpectrumTools::formatThreadSchedule(schedule).c_str());
+
+          phyConfigArgs.erase(mainThreadScheduleIter);
+        }
+
       EMANE::ConfigurationUpdateRequest updateRequest{};
 
       for(const auto & item : phyConfigArgs)
@@ -518,6 +666,8 @@ int main(int argc, char* argv[])
       // post-start the NEM manager
       pNEMManager->postStart();
 
+      logger.log(EMANE::INFO_LEVEL,"memory: %s",EMANE::SpectrumTools::processMemoryStatus().c_str());
+
       struct sigaction action;
 
       memset(&action,0,sizeof(action));
@@ -35,6 +35,7 @@
 #include "otaextractor.h"
 #include "eventextractor.h"
 #include "logservice.h"
+#include "traceprobes.h"
 #include "otaheader.pb.h"
 
 #include <emane/net.h>
@@ -207,6 +208,12 @@ EMANE::SpectrumTools::Recorder::OTAExtractor::process(const void * buf, size_t l
                                            vectorIO,
                                            records);
 
+                          EMANE_SPECTRUM_TOOLS_PROBE4(ota_reassembly_complete,
+                                                      otaHeader.source(),
+                                                      otaHeader.sequence(),
+                                                      parts.size(),
+                                                      totalReceivedPartsBytes);
+
                           // remove part cache and part time store
                           partStore_.erase(iter);
                         }
@@ -292,6 +299,31 @@ EMANE::SpectrumTools::Recorder::OTAExtractor::process(const void * buf, size_t l
   return records;
 }
 
+size_t EMANE::SpectrumTools::Recorder::OTAExtractor::getPartStoreEntries() const
+{
+  return partStore_.size();
+}
+
+size_t EMANE::SpectrumTools::Recorder::OTAExtractor::getPartStoreBytes() const
+{
+  // map node: value plus color, parent, left and right
+  const size_t nodeOverheadBytes{4 * sizeof(void *)};
+
+  size_t bytes{};
+
+  for(const auto & entry : partStore_)
+    {
+      bytes += sizeof(PartStore::value_type) + nodeOverheadBytes;
+
+      for(const auto & part : std::get<4>(entry.second))
+        {
+          bytes += sizeof(Parts::value_type) + nodeOverheadBytes + part.second.capacity();
+        }
+    }
+
+  return bytes;
+}
+
 void
 EMANE::SpectrumTools::Recorder::OTAExtractor::handleOTAMessage(const TimePoint & now,
                                                                size_t eventsSize,
@@ -57,6 +57,12 @@ namespace EMANE
 
         Records process(const void * buf, size_t len);
 
+        // number of messages with parts awaiting reassembly
+        size_t getPartStoreEntries() const;
+
+        // estimated bytes held by parts awaiting reassembly
+        size_t getPartStoreBytes() const;
+
       private:
         Seconds partCheckThreshold_;
         Seconds partTimeoutThreshold_;
@@ -33,6 +33,9 @@
 #include "otaextractor.h"
 #include "eventextractor.h"
 #include "multicastsocket.h"
+#include "threadschedule.h"
+#include "traceprobes.h"
+#include "processmemory.h"
 
 #include <emane/application/logger.h>
 #include <emane/utils/parameterconvert.h>
@@ -43,8 +46,10 @@
 #include <getopt.h>
 #include <unistd.h>
 #include <fstream>
+#include <chrono>
 #include <uuid.h>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 #include <sys/eventfd.h>
@@ -65,15 +70,24 @@ namespace
 
   const char * DEFAULT_EVENT_DEVICE = "lo";
 
+  const std::uint64_t DEFAULT_MEMORY_REPORT_INTERVAL{60};
+
   const uint64_t one{1};
 
   int iFd{};
 
+  int iMemoryFd{};
+
   void sighandler(int)
   {
     write(iFd,&one,sizeof(one));
   }
 
+  void memoryhandler(int)
+  {
+    write(iMemoryFd,&one,sizeof(one));
+  }
+
   class  MulticastSocketPatch : public EMANE::MulticastSocket
   {
   public:
@@ -103,6 +117,8 @@ int main(int argc, char* argv[])
           {"otamanagergroup", 1, nullptr, 4},
           {"eventservicedevice", 1, nullptr, 5},
           {"eventservicegroup", 1, nullptr, 6},
+          {"threadschedule.main", 1, nullptr, 7},
+          {"memoryreportinterval", 1, nullptr, 8},
           {nullptr, 0, nullptr, 0},
         };
 
@@ -115,6 +131,8 @@ int main(int argc, char* argv[])
       std::string sLogFile{};
       std::string sPIDFile{};
       std::string sUUIDFile{};
+      std::pair<EMANE::SpectrumTools::ThreadSchedule,bool> optionalMainThreadSchedule{};
+      std::uint64_t u64MemoryReportIntervalSeconds{DEFAULT_MEMORY_REPORT_INTERVAL};
 
       std::string sOTAGroup{DEFAULT_OTA_GROUP};
       std::string sOTADevice{DEFAULT_OTA_DEVICE};
@@ -135,11 +153,16 @@ int main(int argc, char* argv[])
               std::cout<<"  -f, --logfile FILE             Log to a file instead of stdout."<<std::endl;
               std::cout<<"  -l, --loglevel [0,4]           Set initial log level."<<std::endl;
               std::cout<<"                                  default: "<<DEFAULT_LOG_LEVEL<<std::endl;
+              std::cout<<"  --memoryreportinterval SECONDS Log memory use periodically, 0 to disable."<<std::endl;
+              std::cout<<"                                 SIGUSR1 logs memory use on demand."<<std::endl;
+              std::cout<<"                                  default: "<<DEFAULT_MEMORY_REPORT_INTERVAL<<std::endl;
               std::cout<<"  --pidfile FILE                 Write application pid to file."<<std::endl;
               std::cout<<"  -p, --priority [0,99]          Set realtime priority level."<<std::endl;
               std::cout<<"                                 Only used with -r, --realtime."<<std::endl;
               std::cout<<"                                  default: "<<DEFAULT_PRIORITY_LEVEL<<std::endl;
               std::cout<<"  -r, --realtime                 Set realtime scheduling."<<std::endl;
+              std::cout<<"  --threadschedule.main SCHEDULE Set main thread CPU affinity and scheduling."<<std::endl;
+              std::cout<<"                                  CPULIST[:other|batch|idle|fifo|rr[:PRIORITY]]"<<std::endl;
               std::cout<<"  --uuidfile FILE                Write the application instance UUID to file."<<std::endl;
               std::cout<<"  -v, --version                  Print version and exit."<<std::endl;
               std::cout<<std::endl;
@@ -176,6 +199,33 @@ int main(int argc, char* argv[])
               sEventGroup = optarg;
               break;
 
+            case 7:
+              try
+                {
+                  optionalMainThreadSchedule =
+                    std::make_pair(EMANE::SpectrumTools::parseThreadSchedule(optarg),true);
+                }
+              catch(...)
+                {
+                  std::cerr<<"invalid thread schedule: "<<optarg<<std::endl;
+                  return EXIT_FAILURE;
+                }
+
+              break;
+
+            case 8:
+              try
+                {
+                  u64MemoryReportIntervalSeconds = EMANE::Utils::ParameterConvert{optarg}.toUINT64();
+                }
+              catch(...)
+                {
+                  std::cerr<<"invalid memory report interval: "<<optarg<<std::endl;
+                  return EXIT_FAILURE;
+                }
+
+              break;
+
             case 'r':
               bRealtime = true;
               break;
@@ -317,6 +367,27 @@ int main(int argc, char* argv[])
         }
 
 
+      if(optionalMainThreadSchedule.second)
+        {
+          if(int iError = EMANE::SpectrumTools::applyThreadSchedule(optionalMainThreadSchedule.first))
+            {
+              if(!sLogFile.empty() || !iLogLevel)
+                {
+                  std::cerr<<"unable to apply main thread schedule: "<<strerror(iError)<<std::endl;
+                }
+
+              logger.log(EMANE::ABORT_LEVEL,
+                         "unable to apply main thread schedule: %s",
+                         strerror(iError));
+
+              return EXIT_FAILURE;
+            }
+
+          logger.log(EMANE::INFO_LEVEL,
+                     "main thread schedule: %s",
+                     EMANE::SpectrumTools::formatThreadSchedule(optionalMainThreadSchedule.first).c_str());
+        }
+
       logger.log(EMANE::INFO_LEVEL,"application: %s",ss.str().c_str());
       logger.log(EMANE::INFO_LEVEL,"application uuid: %s",uuidBuf);
 
@@ -379,6 +450,20 @@ int main(int argc, char* argv[])
           return EXIT_FAILURE;
         }
 
+      // eventfd used to request a memory report
+      iMemoryFd = eventfd(0,0);
+
+      memset(&ev,0,sizeof(epoll_event));
+      ev.events = EPOLLIN;
+      ev.data.fd = iMemoryFd;
+
+      if(epoll_ctl(iepollFd,EPOLL_CTL_ADD,iMemoryFd,&ev) == -1)
+        {
+          logger.log(EMANE::ABORT_LEVEL,"unable to add memory eventfd to epoll");
+
+          return EXIT_FAILURE;
+        }
+
       // OTA multicast channel
       MulticastSocketPatch mcastOTA_{};
       mcastOTA_.open(otaGroupAddress,true,sOTADevice);
@@ -418,6 +503,10 @@ int main(int argc, char* argv[])
       sigaction(SIGINT,&action,nullptr);
       sigaction(SIGQUIT,&action,nullptr);
 
+      memset(&action,0,sizeof(action));
+      action.sa_handler = memoryhandler;
+      sigaction(SIGUSR1,&action,nullptr);
+
 #define MAX_EVENTS 32
       struct epoll_event events[32];
       std::uint64_t u64Expired{};
@@ -428,9 +517,33 @@ int main(int argc, char* argv[])
       EMANE::SpectrumTools::Recorder::OTAExtractor otaExtractor{EMANE::Seconds{2},EMANE::Seconds{5}};
       EMANE::SpectrumTools::Recorder::EventExtractor eventExtractor{};
 
+      auto reportMemory = [&logger,&otaExtractor]()
+        {
+          logger.log(EMANE::INFO_LEVEL,
+                     "memory: part store %zu messages %zu bytes, %s",
+                     otaExtractor.getPartStoreEntries(),
+                     otaExtractor.getPartStoreBytes(),
+                     EMANE::SpectrumTools::processMemoryStatus().c_str());
+        };
+
+      std::chrono::seconds memoryReportInterval{u64MemoryReportIntervalSeconds};
+
+      auto nextMemoryReportTime = std::chrono::steady_clock::now() + memoryReportInterval;
+
       while(bRun)
         {
-          nfds = epoll_wait(iepollFd,events,MAX_EVENTS,-1);
+          int iTimeoutMilliseconds{-1};
+
+          if(memoryReportInterval.count())
+            {
+              auto remaining =
+                std::chrono::duration_cast<std::chrono::milliseconds>(nextMemoryReportTime -
+                                                                      std::chrono::steady_clock::now());
+
+              iTimeoutMilliseconds = remaining.count() > 0 ? remaining.count() : 0;
+            }
+
+          nfds = epoll_wait(iepollFd,events,MAX_EVENTS,iTimeoutMilliseconds);
 
           if(nfds == -1)
             {
@@ -454,6 +567,13 @@ int main(int argc, char* argv[])
                       break;
                     }
                 }
+              else if(events[n].data.fd == iMemoryFd)
+                {
+                  if(read(iMemoryFd,&u64Expired,sizeof(u64Expired)) > 0)
+                    {
+                      reportMemory();
+                    }
+                }
               else if(events[n].data.fd == mcastEvent_.handle())
                 {
                   auto len = mcastEvent_.recv(buf,sizeof(buf));
@@ -486,8 +606,20 @@ int main(int argc, char* argv[])
                                            sizeof(u32MessageFrameLength));
 
                   recorderFileStream.write(sSerialization.c_str(),sSerialization.length());
+
+                  EMANE_SPECTRUM_TOOLS_PROBE2(recorder_write,
+                                              record.type(),
+                                              sSerialization.length());
                 }
             }
+
+          if(memoryReportInterval.count() &&
+             std::chrono::steady_clock::now() >= nextMemoryReportTime)
+            {
+              reportMemory();
+
+              nextMemoryReportTime = std::chrono::steady_clock::now() + memoryReportInterval;
+            }
         }
 
       recorderFileStream.close();
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "antennagaingrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+EMANE::SpectrumTools::AntennaGainGrid::AntennaGainGrid(const PatternFunction & pattern,
+                                                       double dResolutionDegrees):
+  dResolutionDegrees_{dResolutionDegrees},
+  azimuthCount_{static_cast<std::size_t>(std::round(360 / dResolutionDegrees))},
+  elevationCount_{static_cast<std::size_t>(std::round(180 / dResolutionDegrees)) + 1},
+  gains_(azimuthCount_ * elevationCount_)
+{
+  for(std::size_t e = 0; e < elevationCount_; ++e)
+    {
+      auto iElevation =
+        static_cast<std::int16_t>(std::round(-90 + e * dResolutionDegrees_));
+
+      for(std::size_t a = 0; a < azimuthCount_; ++a)
+        {
+          auto iAzimuth =
+            static_cast<std::int16_t>(std::round(a * dResolutionDegrees_)) % 360;
+
+          gains_[e * azimuthCount_ + a] = pattern(iAzimuth,iElevation);
+        }
+    }
+}
+
+double EMANE::SpectrumTools::AntennaGainGrid::getGain(double dAzimuthDegrees,
+                                                      double dElevationDegrees) const
+{
+  dElevationDegrees = std::fmod(dElevationDegrees,360.0);
+
+  if(dElevationDegrees > 180)
+    {
+      dElevationDegrees -= 360;
+    }
+  else if(dElevationDegrees < -180)
+    {
+      dElevationDegrees += 360;
+    }
+
+  if(dElevationDegrees > 90)
+    {
+      dElevationDegrees = 180 - dElevationDegrees;
+      dAzimuthDegrees += 180;
+    }
+  else if(dElevationDegrees < -90)
+    {
+      dElevationDegrees = -180 - dElevationDegrees;
+      dAzimuthDegrees += 180;
+    }
+
+  dAzimuthDegrees = std::fmod(dAzimuthDegrees,360.0);
+
+  if(dAzimuthDegrees < 0)
+    {
+      dAzimuthDegrees += 360;
+    }
+
+  double dAzimuthIndex{dAzimuthDegrees / dResolutionDegrees_};
+
+  double dElevationIndex{(std::min(std::max(dElevationDegrees,-90.0),90.0) + 90) /
+      dResolutionDegrees_};
+
+  auto a0 = static_cast<std::size_t>(dAzimuthIndex) % azimuthCount_;
+  auto a1 = (a0 + 1) % azimuthCount_;
+  double dAzimuthFraction{dAzimuthIndex - std::floor(dAzimuthIndex)};
+
+  auto e0 = std::min(static_cast<std::size_t>(dElevationIndex),elevationCount_ - 1);
+  auto e1 = std::min(e0 + 1,elevationCount_ - 1);
+  double dElevationFraction{dElevationIndex - e0};
+
+  const float * pRow0{gains_.data() + e0 * azimuthCount_};
+  const float * pRow1{gains_.data() + e1 * azimuthCount_};
+
+  double dGain0{pRow0[a0] + (pRow0[a1] - pRow0[a0]) * dAzimuthFraction};
+  double dGain1{pRow1[a0] + (pRow1[a1] - pRow1[a0]) * dAzimuthFraction};
+
+  return dGain0 + (dGain1 - dGain0) * dElevationFraction;
+}
+
+std::size_t EMANE::SpectrumTools::AntennaGainGrid::getCommittedBytes() const
+{
+  return sizeof(*this) + gains_.capacity() * sizeof(float);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSANTENNAGAINGRID_HEADER_
+#define EMANESPECTRUMTOOLSANTENNAGAINGRID_HEADER_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class AntennaGainGrid
+     *
+     * @brief Dense azimuth/elevation gain grid sampled once from an
+     * antenna (or blockage) pattern, evaluated with bilinear
+     * interpolation.
+     *
+     * Azimuth wraps over [0,360). Elevation beyond +/-90 folds over
+     * the pole, (el,az) becoming (180-el,az+180), as a pointing
+     * offset can take a relative elevation past vertical.
+     */
+    class AntennaGainGrid
+    {
+    public:
+      // pattern gain dBi for integer azimuth [0,359] and elevation [-90,90]
+      using PatternFunction = std::function<double(std::int16_t,std::int16_t)>;
+
+      /**
+       * @param pattern Pattern to sample
+       * @param dResolutionDegrees Grid resolution, must evenly divide 90
+       */
+      AntennaGainGrid(const PatternFunction & pattern,
+                      double dResolutionDegrees);
+
+      double getGain(double dAzimuthDegrees, double dElevationDegrees) const;
+
+      std::size_t getCommittedBytes() const;
+
+    private:
+      double dResolutionDegrees_;
+      std::size_t azimuthCount_;
+      std::size_t elevationCount_;
+      std::vector<float> gains_; // elevation major
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSANTENNAGAINGRID_HEADER_
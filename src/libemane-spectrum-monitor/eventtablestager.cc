@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "eventtablestager.h"
+
+namespace
+{
+  bool isSame(const EMANE::Events::Location & a,
+              const EMANE::Events::Location & b)
+  {
+    const auto & positionA = a.getPosition();
+    const auto & positionB = b.getPosition();
+
+    if(positionA.getLatitudeDegrees() != positionB.getLatitudeDegrees() ||
+       positionA.getLongitudeDegrees() != positionB.getLongitudeDegrees() ||
+       positionA.getAltitudeMeters() != positionB.getAltitudeMeters())
+      {
+        return false;
+      }
+
+    auto orientationA = a.getOrientation();
+    auto orientationB = b.getOrientation();
+
+    if(orientationA.second != orientationB.second ||
+       (orientationA.second &&
+        (orientationA.first.getRollDegrees() != orientationB.first.getRollDegrees() ||
+         orientationA.first.getPitchDegrees() != orientationB.first.getPitchDegrees() ||
+         orientationA.first.getYawDegrees() != orientationB.first.getYawDegrees())))
+      {
+        return false;
+      }
+
+    auto velocityA = a.getVelocity();
+    auto velocityB = b.getVelocity();
+
+    return velocityA.second == velocityB.second &&
+      (!velocityA.second ||
+       (velocityA.first.getAzimuthDegrees() == velocityB.first.getAzimuthDegrees() &&
+        velocityA.first.getElevationDegrees() == velocityB.first.getElevationDegrees() &&
+        velocityA.first.getMagnitudeMetersPerSecond() == velocityB.first.getMagnitudeMetersPerSecond()));
+  }
+
+  bool isSame(const EMANE::Events::Pathloss & a,
+              const EMANE::Events::Pathloss & b)
+  {
+    return a.getForwardPathlossdB() == b.getForwardPathlossdB() &&
+      a.getReversePathlossdB() == b.getReversePathlossdB();
+  }
+
+  bool isSame(const EMANE::Events::AntennaProfile & a,
+              const EMANE::Events::AntennaProfile & b)
+  {
+    return a.getAntennaProfileId() == b.getAntennaProfileId() &&
+      a.getAntennaAzimuthDegrees() == b.getAntennaAzimuthDegrees() &&
+      a.getAntennaElevationDegrees() == b.getAntennaElevationDegrees();
+  }
+
+  bool isSame(const EMANE::Events::FadingSelection & a,
+              const EMANE::Events::FadingSelection & b)
+  {
+    return a.getFadingModel() == b.getFadingModel();
+  }
+}
+
+EMANE::SpectrumTools::EventTableStager::EventTableStager(EventTablePublisher & eventTablePublisher):
+  eventTablePublisher_(eventTablePublisher),
+  maxRowsPerRefresh_{},
+  locations_{},
+  pathlosses_{},
+  antennaProfiles_{},
+  fadingSelections_{}{}
+
+void EMANE::SpectrumTools::EventTableStager::setMaxRowsPerRefresh(std::size_t maxRowsPerRefresh)
+{
+  maxRowsPerRefresh_ = maxRowsPerRefresh;
+}
+
+void EMANE::SpectrumTools::EventTableStager::update(const Events::Locations & locations)
+{
+  stage(locations_,locations);
+}
+
+void EMANE::SpectrumTools::EventTableStager::update(const Events::Pathlosses & pathlosses)
+{
+  stage(pathlosses_,pathlosses);
+}
+
+void EMANE::SpectrumTools::EventTableStager::update(const Events::AntennaProfiles & antennaProfiles)
+{
+  stage(antennaProfiles_,antennaProfiles);
+}
+
+void EMANE::SpectrumTools::EventTableStager::update(const Events::FadingSelections & fadingSelections)
+{
+  stage(fadingSelections_,fadingSelections);
+}
+
+std::size_t EMANE::SpectrumTools::EventTableStager::refresh()
+{
+  publish<Events::Location,Events::Locations>(locations_);
+  publish<Events::Pathloss,Events::Pathlosses>(pathlosses_);
+  publish<Events::AntennaProfile,Events::AntennaProfiles>(antennaProfiles_);
+  publish<Events::FadingSelection,Events::FadingSelections>(fadingSelections_);
+
+  return locations_.staged_.size() +
+    pathlosses_.staged_.size() +
+    antennaProfiles_.staged_.size() +
+    fadingSelections_.staged_.size();
+}
+
+std::size_t EMANE::SpectrumTools::EventTableStager::getCommittedBytes() const
+{
+  return committedBytes(locations_) +
+    committedBytes(pathlosses_) +
+    committedBytes(antennaProfiles_) +
+    committedBytes(fadingSelections_);
+}
+
+template<typename Entry>
+std::size_t EMANE::SpectrumTools::EventTableStager::committedBytes(const Stage<Entry> & stage)
+{
+  // map node: value plus color, parent, left and right
+  const std::size_t nodeBytes{sizeof(typename std::map<NEMId,Entry>::value_type) + 4 * sizeof(void *)};
+
+  return (stage.staged_.size() + stage.published_.size()) * nodeBytes;
+}
+
+template<typename Entry, typename Entries>
+void EMANE::SpectrumTools::EventTableStager::stage(Stage<Entry> & stage,
+                                                   const Entries & entries)
+{
+  for(const auto & entry : entries)
+    {
+      NEMId id{entry.getNEMId()};
+
+      // a newer entry always replaces a staged one
+      stage.staged_.erase(id);
+
+      auto iter = stage.published_.find(id);
+
+      if(iter == stage.published_.end() || !isSame(iter->second,entry))
+        {
+          stage.staged_.insert(std::make_pair(id,entry));
+        }
+    }
+}
+
+template<typename Entry, typename Entries>
+void EMANE::SpectrumTools::EventTableStager::publish(Stage<Entry> & stage)
+{
+  if(stage.staged_.empty())
+    {
+      return;
+    }
+
+  Entries entries{};
+
+  // resume where the last capped refresh stopped so continually
+  // changing low NEM ids cannot starve the rest of the table
+  auto iter = stage.staged_.lower_bound(stage.resumeId_);
+
+  for(std::size_t i = 0;
+      !stage.staged_.empty() && (!maxRowsPerRefresh_ || i < maxRowsPerRefresh_);
+      ++i)
+    {
+      if(iter == stage.staged_.end())
+        {
+          iter = stage.staged_.begin();
+        }
+
+      entries.push_back(iter->second);
+
+      stage.published_.erase(iter->first);
+
+      stage.published_.insert(*iter);
+
+      iter = stage.staged_.erase(iter);
+    }
+
+  stage.resumeId_ = iter != stage.staged_.end() ? iter->first : 0;
+
+  eventTablePublisher_.update(entries);
+}
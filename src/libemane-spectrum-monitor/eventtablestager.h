@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSEVENTTABLESTAGER_HEADER_
+#define EMANESPECTRUMTOOLSEVENTTABLESTAGER_HEADER_
+
+#include "eventtablepublisher.h"
+
+#include "emane/types.h"
+#include "emane/events/location.h"
+#include "emane/events/pathloss.h"
+#include "emane/events/antennaprofile.h"
+#include "emane/events/fadingselection.h"
+
+#include <cstdint>
+#include <map>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class EventTableStager
+     *
+     * @brief Stages location, pathloss, antenna profile and fading
+     * selection event entries for the event table publisher.
+     *
+     * Only entries that differ from the last published entry for the
+     * same NEM are staged, and a staged entry is replaced by any newer
+     * entry for that NEM. Staged entries are applied to the event
+     * tables in batches of at most maxRowsPerRefresh rows per table,
+     * so a large event never rebuilds the tables on the receive path.
+     */
+    class EventTableStager
+    {
+    public:
+      explicit EventTableStager(EventTablePublisher & eventTablePublisher);
+
+      void setMaxRowsPerRefresh(std::size_t maxRowsPerRefresh);
+
+      void update(const Events::Locations & locations);
+
+      void update(const Events::Pathlosses & pathlosses);
+
+      void update(const Events::AntennaProfiles & antennaProfiles);
+
+      void update(const Events::FadingSelections & fadingSelections);
+
+      /**
+       * Applies staged entries to the event tables, at most
+       * maxRowsPerRefresh per table
+       *
+       * @return Number of entries still staged
+       */
+      std::size_t refresh();
+
+      // estimated bytes held by staged and published entries
+      std::size_t getCommittedBytes() const;
+
+    private:
+      template<typename Entry>
+      struct Stage
+      {
+        std::map<NEMId,Entry> staged_{};
+        std::map<NEMId,Entry> published_{};
+        NEMId resumeId_{};
+      };
+
+      EventTablePublisher & eventTablePublisher_;
+      std::size_t maxRowsPerRefresh_;
+      Stage<Events::Location> locations_;
+      Stage<Events::Pathloss> pathlosses_;
+      Stage<Events::AntennaProfile> antennaProfiles_;
+      Stage<Events::FadingSelection> fadingSelections_;
+
+      template<typename Entry, typename Entries>
+      void stage(Stage<Entry> & stage, const Entries & entries);
+
+      template<typename Entry, typename Entries>
+      void publish(Stage<Entry> & stage);
+
+      template<typename Entry>
+      static std::size_t committedBytes(const Stage<Entry> & stage);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSEVENTTABLESTAGER_HEADER_
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gaingridmanager.h"
+#include "antennaprofilemanifest.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  const double DEGREES_TO_RADIANS{M_PI / 180.0};
+
+  // WGS84
+  const double SEMI_MAJOR_AXIS_METERS{6378137.0};
+  const double ECCENTRICITY_SQUARED{6.69437999014e-3};
+
+  // bound the radio horizon of any spherical earth model, from the
+  // polar radius to a 4/3 effective equatorial radius
+  const double MIN_HORIZON_EARTH_RADIUS_METERS{6356752.3};
+  const double MAX_HORIZON_EARTH_RADIUS_METERS{SEMI_MAJOR_AXIS_METERS * 4 / 3};
+
+  enum class Horizon
+    {
+      WITHIN,
+      BEYOND,
+      UNKNOWN,
+    };
+
+  std::tuple<double,double,double> toECEF(const EMANE::Position & position)
+  {
+    double dLatitude{position.getLatitudeDegrees() * DEGREES_TO_RADIANS};
+    double dLongitude{position.getLongitudeDegrees() * DEGREES_TO_RADIANS};
+    double dAltitude{position.getAltitudeMeters()};
+
+    double dN{SEMI_MAJOR_AXIS_METERS /
+        std::sqrt(1 - ECCENTRICITY_SQUARED * std::sin(dLatitude) * std::sin(dLatitude))};
+
+    return std::make_tuple((dN + dAltitude) * std::cos(dLatitude) * std::cos(dLongitude),
+                           (dN + dAltitude) * std::cos(dLatitude) * std::sin(dLongitude),
+                           (dN * (1 - ECCENTRICITY_SQUARED) + dAltitude) * std::sin(dLatitude));
+  }
+
+  // classifies a pair against the horizon bounds, pairs between them
+  // need the exact path
+  Horizon checkHorizon(const EMANE::Position & position0,
+                       const EMANE::Position & position1)
+  {
+    double dAltitude0Meters{position0.getAltitudeMeters()};
+    double dAltitude1Meters{position1.getAltitudeMeters()};
+
+    if(dAltitude0Meters <= 0 || dAltitude1Meters <= 0)
+      {
+        return Horizon::UNKNOWN;
+      }
+
+    double dX0{},dY0{},dZ0{};
+    double dX1{},dY1{},dZ1{};
+
+    std::tie(dX0,dY0,dZ0) = toECEF(position0);
+    std::tie(dX1,dY1,dZ1) = toECEF(position1);
+
+    double dDistanceMeters{std::sqrt((dX1 - dX0) * (dX1 - dX0) +
+                                     (dY1 - dY0) * (dY1 - dY0) +
+                                     (dZ1 - dZ0) * (dZ1 - dZ0))};
+
+    double dMinHorizonMeters{std::sqrt(2 * MIN_HORIZON_EARTH_RADIUS_METERS * dAltitude0Meters) +
+                             std::sqrt(2 * MIN_HORIZON_EARTH_RADIUS_METERS * dAltitude1Meters)};
+
+    if(dDistanceMeters <= dMinHorizonMeters)
+      {
+        return Horizon::WITHIN;
+      }
+
+    double dMaxHorizonMeters{std::sqrt((2 * MAX_HORIZON_EARTH_RADIUS_METERS + dAltitude0Meters) * dAltitude0Meters) +
+                             std::sqrt((2 * MAX_HORIZON_EARTH_RADIUS_METERS + dAltitude1Meters) * dAltitude1Meters)};
+
+    // lower bound of the ground distance
+    double dAltitudeDeltaMeters{dAltitude1Meters - dAltitude0Meters};
+
+    double dGroundDistanceMeters{std::sqrt(std::max(0.0,
+                                                    dDistanceMeters * dDistanceMeters -
+                                                    dAltitudeDeltaMeters * dAltitudeDeltaMeters))};
+
+    if(dGroundDistanceMeters > dMaxHorizonMeters)
+      {
+        return Horizon::BEYOND;
+      }
+
+    return Horizon::UNKNOWN;
+  }
+
+  // azimuth and elevation in degrees of other as seen from self,
+  // relative to the self platform orientation
+  std::pair<double,double>
+  bodyDirection(const EMANE::PositionOrientationVelocity & selfPOV,
+                const EMANE::PositionOrientationVelocity & otherPOV)
+  {
+    const auto & selfPosition = selfPOV.getPosition();
+
+    double dX0{},dY0{},dZ0{};
+    double dX1{},dY1{},dZ1{};
+
+    std::tie(dX0,dY0,dZ0) = toECEF(selfPosition);
+    std::tie(dX1,dY1,dZ1) = toECEF(otherPOV.getPosition());
+
+    double dDX{dX1 - dX0};
+    double dDY{dY1 - dY0};
+    double dDZ{dZ1 - dZ0};
+
+    double dLatitude{selfPosition.getLatitudeDegrees() * DEGREES_TO_RADIANS};
+    double dLongitude{selfPosition.getLongitudeDegrees() * DEGREES_TO_RADIANS};
+
+    double dSinLat{std::sin(dLatitude)};
+    double dCosLat{std::cos(dLatitude)};
+    double dSinLon{std::sin(dLongitude)};
+    double dCosLon{std::cos(dLongitude)};
+
+    // local north, east, down
+    double dNorth{-dSinLat * dCosLon * dDX - dSinLat * dSinLon * dDY + dCosLat * dDZ};
+    double dEast{-dSinLon * dDX + dCosLon * dDY};
+    double dDown{-(dCosLat * dCosLon * dDX + dCosLat * dSinLon * dDY + dSinLat * dDZ)};
+
+    auto optionalOrientation = selfPOV.getOrientation();
+
+    if(optionalOrientation.second)
+      {
+        const auto & orientation = optionalOrientation.first;
+
+        double dYaw{orientation.getYawDegrees() * DEGREES_TO_RADIANS};
+        double dPitch{orientation.getPitchDegrees() * DEGREES_TO_RADIANS};
+        double dRoll{orientation.getRollDegrees() * DEGREES_TO_RADIANS};
+
+        // yaw, pitch, roll into the body frame
+        double dX{std::cos(dYaw) * dNorth + std::sin(dYaw) * dEast};
+        double dY{-std::sin(dYaw) * dNorth + std::cos(dYaw) * dEast};
+        double dZ{dDown};
+
+        dNorth = std::cos(dPitch) * dX - std::sin(dPitch) * dZ;
+        dZ = std::sin(dPitch) * dX + std::cos(dPitch) * dZ;
+
+        dEast = std::cos(dRoll) * dY + std::sin(dRoll) * dZ;
+        dDown = -std::sin(dRoll) * dY + std::cos(dRoll) * dZ;
+      }
+
+    double dAzimuthDegrees{std::atan2(dEast,dNorth) / DEGREES_TO_RADIANS};
+
+    if(dAzimuthDegrees < 0)
+      {
+        dAzimuthDegrees += 360;
+      }
+
+    double dElevationDegrees{std::atan2(-dDown,std::hypot(dNorth,dEast)) / DEGREES_TO_RADIANS};
+
+    return {dAzimuthDegrees,dElevationDegrees};
+  }
+}
+
+EMANE::SpectrumTools::GainGridManager::GainGridManager(NEMId id,
+                                                       AntennaIndex rxAntennaIndex,
+                                                       AntennaManager & antennaManager,
+                                                       GainManager & gainManager):
+  id_{id},
+  rxAntennaIndex_{rxAntennaIndex},
+  antennaManager_(antennaManager),
+  gainManager_(gainManager),
+  dResolutionDegrees_{1},
+  u64AccuracySampleRate_{},
+  u64Calls_{},
+  u64Samples_{},
+  dSumAbsErrordB_{},
+  dMaxAbsErrordB_{},
+  pNumGainGridSamples_{},
+  pNumGainGridStatusMismatch_{},
+  pAvgGainGridAbsErrordB_{},
+  pMaxGainGridAbsErrordB_{}{}
+
+void EMANE::SpectrumTools::GainGridManager::registerStatistics(StatisticRegistrar & statisticRegistrar)
+{
+  pNumGainGridSamples_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numGainGridSamples",
+                                                      StatisticProperties::NONE,
+                                                      "Number of gain grid results compared against"
+                                                      " the exact gain path.");
+
+  pNumGainGridStatusMismatch_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numGainGridStatusMismatch",
+                                                      StatisticProperties::NONE,
+                                                      "Number of sampled gain grid results whose status"
+                                                      " differed from the exact gain path.");
+
+  pAvgGainGridAbsErrordB_ =
+    statisticRegistrar.registerNumeric<double>("avgGainGridAbsErrordB",
+                                               StatisticProperties::NONE,
+                                               "Average absolute error in dB of the sampled gain grid"
+                                               " tx plus rx gain against the exact gain path.");
+
+  pMaxGainGridAbsErrordB_ =
+    statisticRegistrar.registerNumeric<double>("maxGainGridAbsErrordB",
+                                               StatisticProperties::NONE,
+                                               "Maximum absolute error in dB of the sampled gain grid"
+                                               " tx plus rx gain against the exact gain path.");
+}
+
+std::size_t EMANE::SpectrumTools::GainGridManager::getCommittedBytes() const
+{
+  std::size_t bytes{};
+
+  for(const auto & entry : profileGridsMap_)
+    {
+      if(entry.second)
+        {
+          bytes += sizeof(ProfileGrids);
+
+          if(entry.second->pAntennaGainGrid_)
+            {
+              bytes += entry.second->pAntennaGainGrid_->getCommittedBytes();
+            }
+
+          if(entry.second->pBlockageGainGrid_)
+            {
+              bytes += entry.second->pBlockageGainGrid_->getCommittedBytes();
+            }
+        }
+    }
+
+  return bytes;
+}
+
+void EMANE::SpectrumTools::GainGridManager::configure(double dResolutionDegrees,
+                                                      std::uint64_t u64AccuracySampleRate)
+{
+  dResolutionDegrees_ = dResolutionDegrees;
+
+  u64AccuracySampleRate_ = u64AccuracySampleRate;
+
+  // grids are rebuilt on demand at the new resolution
+  profileGridsMap_.clear();
+}
+
+EMANE::SpectrumTools::GainGridManager::GainInfo
+EMANE::SpectrumTools::GainGridManager::determineGain(NEMId transmitterId,
+                                                     AntennaIndex txAntennaIndex,
+                                                     const std::pair<LocationInfo,bool> & locationInfo)
+{
+  auto gainInfo = determineGain_i(transmitterId,txAntennaIndex,locationInfo);
+
+  if(std::get<4>(gainInfo))
+    {
+      return gainInfo;
+    }
+
+  if(u64AccuracySampleRate_ && ++u64Calls_ % u64AccuracySampleRate_ == 0)
+    {
+      auto exactGainInfo = gainManager_.determineGain(transmitterId,
+                                                      txAntennaIndex,
+                                                      locationInfo.first);
+
+      ++*pNumGainGridSamples_;
+
+      if(std::get<2>(exactGainInfo) != std::get<2>(gainInfo))
+        {
+          ++*pNumGainGridStatusMismatch_;
+        }
+      else if(std::get<2>(gainInfo) == GainManager::GainStatus::SUCCESS)
+        {
+          double dAbsErrordB{std::fabs(std::get<0>(gainInfo) + std::get<1>(gainInfo) -
+                                       std::get<0>(exactGainInfo) - std::get<1>(exactGainInfo))};
+
+          ++u64Samples_;
+
+          dSumAbsErrordB_ += dAbsErrordB;
+
+          dMaxAbsErrordB_ = std::max(dMaxAbsErrordB_,dAbsErrordB);
+
+          *pAvgGainGridAbsErrordB_ = dSumAbsErrordB_ / u64Samples_;
+
+          *pMaxGainGridAbsErrordB_ = dMaxAbsErrordB_;
+        }
+    }
+
+  return gainInfo;
+}
+
+EMANE::SpectrumTools::GainGridManager::GainInfo
+EMANE::SpectrumTools::GainGridManager::determineGain_i(NEMId transmitterId,
+                                                       AntennaIndex txAntennaIndex,
+                                                       const std::pair<LocationInfo,bool> & locationInfo)
+{
+  auto rxAntennaInfo = antennaManager_.getAntennaInfo(id_,rxAntennaIndex_);
+
+  auto txAntennaInfo = antennaManager_.getAntennaInfo(transmitterId,txAntennaIndex);
+
+  if(!rxAntennaInfo.second || !txAntennaInfo.second)
+    {
+      return GainInfo{0,0,GainManager::GainStatus::ERROR_ANTENNA_INDEX,false,false};
+    }
+
+  const auto & localPOV = locationInfo.first.getLocalPOV();
+  const auto & remotePOV = locationInfo.first.getRemotePOV();
+
+  auto txPointing = txAntennaInfo.first.antenna_.getPointing();
+  auto rxPointing = rxAntennaInfo.first.antenna_.getPointing();
+
+  if((txPointing.second || rxPointing.second) && locationInfo.second)
+    {
+      // placement offsets move the antenna away from the platform
+      // position the grid geometry uses
+      for(const auto & pointing : {txPointing,rxPointing})
+        {
+          if(pointing.second)
+            {
+              auto pProfileGrids = getProfileGrids(pointing.first.getProfileId());
+
+              if(pProfileGrids && pProfileGrids->bPlacement_)
+                {
+                  return exactGain(transmitterId,txAntennaIndex,locationInfo);
+                }
+            }
+        }
+
+      switch(checkHorizon(localPOV.getPosition(),remotePOV.getPosition()))
+        {
+        case Horizon::WITHIN:
+          break;
+
+        case Horizon::BEYOND:
+          return GainInfo{0,0,GainManager::GainStatus::ERROR_HORIZON,false,false};
+
+        case Horizon::UNKNOWN:
+          return exactGain(transmitterId,txAntennaIndex,locationInfo);
+        }
+    }
+
+  auto txGain = antennaGain(txAntennaInfo.first.antenna_,
+                            remotePOV,
+                            localPOV,
+                            locationInfo.second);
+
+  if(txGain.second != GainManager::GainStatus::SUCCESS)
+    {
+      return GainInfo{0,0,txGain.second,false,false};
+    }
+
+  auto rxGain = antennaGain(rxAntennaInfo.first.antenna_,
+                            localPOV,
+                            remotePOV,
+                            locationInfo.second);
+
+  if(rxGain.second != GainManager::GainStatus::SUCCESS)
+    {
+      return GainInfo{0,0,rxGain.second,false,false};
+    }
+
+  return GainInfo{txGain.first,rxGain.first,GainManager::GainStatus::SUCCESS,false,false};
+}
+
+EMANE::SpectrumTools::GainGridManager::GainInfo
+EMANE::SpectrumTools::GainGridManager::exactGain(NEMId transmitterId,
+                                                 AntennaIndex txAntennaIndex,
+                                                 const std::pair<LocationInfo,bool> & locationInfo)
+{
+  return std::tuple_cat(gainManager_.determineGain(transmitterId,
+                                                   txAntennaIndex,
+                                                   locationInfo.first),
+                        std::make_tuple(true));
+}
+
+std::pair<double,EMANE::GainManager::GainStatus>
+EMANE::SpectrumTools::GainGridManager::antennaGain(const Antenna & antenna,
+                                                   const PositionOrientationVelocity & selfPOV,
+                                                   const PositionOrientationVelocity & otherPOV,
+                                                   bool bHaveLocation)
+{
+  auto optionalPointing = antenna.getPointing();
+
+  if(!optionalPointing.second)
+    {
+      auto optionalFixedGaindBi = antenna.getFixedGaindBi();
+
+      if(optionalFixedGaindBi.second)
+        {
+          return {optionalFixedGaindBi.first,GainManager::GainStatus::SUCCESS};
+        }
+
+      return {0,GainManager::GainStatus::ERROR_PROFILEINFO};
+    }
+
+  const auto & pointing = optionalPointing.first;
+
+  auto pProfileGrids = getProfileGrids(pointing.getProfileId());
+
+  if(!pProfileGrids)
+    {
+      return {0,GainManager::GainStatus::ERROR_PROFILEINFO};
+    }
+
+  if(!bHaveLocation)
+    {
+      return {0,GainManager::GainStatus::ERROR_LOCATIONINFO};
+    }
+
+  double dAzimuthDegrees{};
+  double dElevationDegrees{};
+
+  std::tie(dAzimuthDegrees,dElevationDegrees) = bodyDirection(selfPOV,otherPOV);
+
+  double dGaindBi{pProfileGrids->pAntennaGainGrid_->getGain(dAzimuthDegrees - pointing.getAzimuthDegrees(),
+                                                            dElevationDegrees - pointing.getElevationDegrees())};
+
+  if(pProfileGrids->pBlockageGainGrid_)
+    {
+      dGaindBi += pProfileGrids->pBlockageGainGrid_->getGain(dAzimuthDegrees,
+                                                             dElevationDegrees);
+    }
+
+  return {dGaindBi,GainManager::GainStatus::SUCCESS};
+}
+
+const EMANE::SpectrumTools::GainGridManager::ProfileGrids *
+EMANE::SpectrumTools::GainGridManager::getProfileGrids(AntennaProfileId profileId)
+{
+  auto iter = profileGridsMap_.find(profileId);
+
+  if(iter == profileGridsMap_.end())
+    {
+      std::unique_ptr<ProfileGrids> pProfileGrids{};
+
+      auto optionalProfileInfo =
+        AntennaProfileManifest::instance()->getProfileInfo(profileId);
+
+      if(optionalProfileInfo.second)
+        {
+          auto pAntennaPattern = std::get<0>(optionalProfileInfo.first);
+          auto pBlockagePattern = std::get<1>(optionalProfileInfo.first);
+          const auto & placement = std::get<2>(optionalProfileInfo.first);
+
+          pProfileGrids.reset(new ProfileGrids{});
+
+          pProfileGrids->bPlacement_ = placement.getNorthMeters() != 0 ||
+            placement.getEastMeters() != 0 ||
+            placement.getUpMeters() != 0;
+
+          pProfileGrids->pAntennaGainGrid_.reset(new AntennaGainGrid{[pAntennaPattern](std::int16_t iAzimuth,
+                                                                                       std::int16_t iElevation)
+                                                                     {
+                                                                       return pAntennaPattern->getGain(iAzimuth,
+                                                                                                       iElevation);
+                                                                     },
+                                                                     dResolutionDegrees_});
+
+          if(pBlockagePattern)
+            {
+              pProfileGrids->pBlockageGainGrid_.reset(new AntennaGainGrid{[pBlockagePattern](std::int16_t iAzimuth,
+                                                                                             std::int16_t iElevation)
+                                                                          {
+                                                                            return pBlockagePattern->getGain(iAzimuth,
+                                                                                                             iElevation);
+                                                                          },
+                                                                          dResolutionDegrees_});
+            }
+        }
+
+      iter = profileGridsMap_.insert(std::make_pair(profileId,std::move(pProfileGrids))).first;
+    }
+
+  return iter->second.get();
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSGAINGRIDMANAGER_HEADER_
+#define EMANESPECTRUMTOOLSGAINGRIDMANAGER_HEADER_
+
+#include "antennagaingrid.h"
+
+#include "gainmanager.h"
+#include "antennamanager.h"
+#include "locationinfo.h"
+
+#include "emane/statisticregistrar.h"
+#include "emane/statisticnumeric.h"
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class GainGridManager
+     *
+     * @brief Determines antenna gain using dense gain grids built once
+     * per antenna profile, instead of evaluating the profile patterns
+     * for every packet.
+     *
+     * Antenna placement offsets and receivers near the radio horizon
+     * are not represented by the grids, those determinations use the
+     * exact GainManager path.
+     *
+     * Every accuracy sample rate calls, the exact GainManager path is
+     * also evaluated and the absolute gain error and any status
+     * mismatch are recorded as statistics.
+     */
+    class GainGridManager
+    {
+    public:
+      using GainInfo = std::tuple<double, // tx gain dBi
+                                  double, // rx gain dBi
+                                  GainManager::GainStatus,
+                                  bool, // cache hit
+                                  bool>; // exact path used, cache hit valid
+
+      GainGridManager(NEMId id,
+                      AntennaIndex rxAntennaIndex,
+                      AntennaManager & antennaManager,
+                      GainManager & gainManager);
+
+      void registerStatistics(StatisticRegistrar & statisticRegistrar);
+
+      /**
+       * @param dResolutionDegrees Grid resolution, must evenly divide 90
+       * @param u64AccuracySampleRate Compare 1 in N results against
+       * the exact path, 0 to disable
+       */
+      void configure(double dResolutionDegrees,
+                     std::uint64_t u64AccuracySampleRate);
+
+      GainInfo determineGain(NEMId transmitterId,
+                             AntennaIndex txAntennaIndex,
+                             const std::pair<LocationInfo,bool> & locationInfo);
+
+      // bytes held by the gain grids of all known profiles
+      std::size_t getCommittedBytes() const;
+
+    private:
+      struct ProfileGrids
+      {
+        std::unique_ptr<AntennaGainGrid> pAntennaGainGrid_;
+        std::unique_ptr<AntennaGainGrid> pBlockageGainGrid_;
+        bool bPlacement_;
+      };
+
+      NEMId id_;
+      AntennaIndex rxAntennaIndex_;
+      AntennaManager & antennaManager_;
+      GainManager & gainManager_;
+      double dResolutionDegrees_;
+      std::uint64_t u64AccuracySampleRate_;
+      std::uint64_t u64Calls_;
+      std::uint64_t u64Samples_;
+      double dSumAbsErrordB_;
+      double dMaxAbsErrordB_;
+      StatisticNumeric<std::uint64_t> * pNumGainGridSamples_;
+      StatisticNumeric<std::uint64_t> * pNumGainGridStatusMismatch_;
+      StatisticNumeric<double> * pAvgGainGridAbsErrordB_;
+      StatisticNumeric<double> * pMaxGainGridAbsErrordB_;
+
+      // nullptr for unknown profiles
+      std::map<AntennaProfileId,std::unique_ptr<ProfileGrids>> profileGridsMap_;
+
+      GainInfo determineGain_i(NEMId transmitterId,
+                               AntennaIndex txAntennaIndex,
+                               const std::pair<LocationInfo,bool> & locationInfo);
+
+      GainInfo exactGain(NEMId transmitterId,
+                         AntennaIndex txAntennaIndex,
+                         const std::pair<LocationInfo,bool> & locationInfo);
+
+      std::pair<double,GainManager::GainStatus>
+      antennaGain(const Antenna & antenna,
+                  const PositionOrientationVelocity & selfPOV,
+                  const PositionOrientationVelocity & otherPOV,
+                  bool bHaveLocation);
+
+      const ProfileGrids * getProfileGrids(AntennaProfileId profileId);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSGAINGRIDMANAGER_HEADER_
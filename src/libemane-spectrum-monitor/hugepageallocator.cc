@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hugepageallocator.h"
+
+#include <cstdlib>
+#include <sys/mman.h>
+
+namespace
+{
+  const std::size_t HUGE_PAGE_SIZE{2 * 1024 * 1024};
+
+  const std::size_t PAGE_SIZE{4096};
+
+  enum class Kind : std::uint8_t
+    {
+      HEAP,
+      ALIGNED,
+      MAPPED,
+    };
+
+  // precedes each allocation, padded so huge page backed storage
+  // starts on a cache line
+  struct Header
+  {
+    Kind kind_;
+    std::size_t length_;
+    char pad_[48];
+  };
+
+  void * mapHugePages(std::size_t length)
+  {
+#ifdef MAP_HUGETLB
+    void * p = mmap(nullptr,
+                    length,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE,
+                    -1,
+                    0);
+
+    return p != MAP_FAILED ? p : nullptr;
+#else
+    (void) length;
+    return nullptr;
+#endif
+  }
+
+  void * alignHugePages(std::size_t length)
+  {
+    void * p{};
+
+    if(posix_memalign(&p,HUGE_PAGE_SIZE,length))
+      {
+        return nullptr;
+      }
+
+#ifdef MADV_HUGEPAGE
+    madvise(p,length,MADV_HUGEPAGE);
+#endif
+
+    // pre-fault
+    for(std::size_t i = 0; i < length; i += PAGE_SIZE)
+      {
+        static_cast<volatile char *>(p)[i] = 0;
+      }
+
+    return p;
+  }
+}
+
+void * EMANE::SpectrumTools::hugePageAllocate(std::size_t bytes, HugePageMode mode)
+{
+  std::size_t length{bytes + sizeof(Header)};
+
+  void * p{};
+
+  Kind kind{Kind::HEAP};
+
+  // allocations smaller than a huge page are not worth one
+  if(mode != HugePageMode::NONE && length >= HUGE_PAGE_SIZE)
+    {
+      length = (length + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+      if(mode == HugePageMode::EXPLICIT && (p = mapHugePages(length)))
+        {
+          kind = Kind::MAPPED;
+        }
+      else if((p = alignHugePages(length)))
+        {
+          kind = Kind::ALIGNED;
+        }
+      else
+        {
+          throw std::bad_alloc{};
+        }
+    }
+  else
+    {
+      p = ::operator new(length);
+    }
+
+  auto pHeader = static_cast<Header *>(p);
+
+  pHeader->kind_ = kind;
+  pHeader->length_ = length;
+
+  return pHeader + 1;
+}
+
+void EMANE::SpectrumTools::hugePageDeallocate(void * p)
+{
+  if(!p)
+    {
+      return;
+    }
+
+  auto pHeader = static_cast<Header *>(p) - 1;
+
+  switch(pHeader->kind_)
+    {
+    case Kind::MAPPED:
+      munmap(pHeader,pHeader->length_);
+      break;
+
+    case Kind::ALIGNED:
+      free(pHeader);
+      break;
+
+    default:
+      ::operator delete(pHeader);
+      break;
+    }
+}
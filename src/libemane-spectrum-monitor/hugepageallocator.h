@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSHUGEPAGEALLOCATOR_HEADER_
+#define EMANESPECTRUMTOOLSHUGEPAGEALLOCATOR_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    enum class HugePageMode
+      {
+        NONE,
+        TRANSPARENT,
+        EXPLICIT,
+      };
+
+    /**
+     * Allocates bytes using mode
+     *
+     * @param bytes Number of bytes
+     * @param mode NONE uses operator new. TRANSPARENT uses huge page
+     * aligned memory advised for transparent huge pages. EXPLICIT
+     * maps pre-reserved huge pages, falling back to TRANSPARENT when
+     * none are available.
+     *
+     * @note TRANSPARENT and EXPLICIT memory is pre-faulted.
+     *
+     * @throw std::bad_alloc
+     */
+    void * hugePageAllocate(std::size_t bytes, HugePageMode mode);
+
+    /**
+     * Deallocates memory allocated with hugePageAllocate, using the
+     * method recorded at allocation
+     */
+    void hugePageDeallocate(void * p);
+
+    /**
+     * @class HugePageAllocator
+     *
+     * @brief Allocator for noise recorder backend storage that can
+     * back large allocations with huge pages.
+     */
+    template<typename T>
+    class HugePageAllocator
+    {
+    public:
+      using value_type = T;
+
+      explicit HugePageAllocator(HugePageMode mode = HugePageMode::NONE):
+        mode_{mode}{}
+
+      template<typename U>
+      HugePageAllocator(const HugePageAllocator<U> & other):
+        mode_{other.mode()}{}
+
+      T * allocate(std::size_t n)
+      {
+        return static_cast<T *>(hugePageAllocate(n * sizeof(T),mode_));
+      }
+
+      void deallocate(T * p, std::size_t)
+      {
+        hugePageDeallocate(p);
+      }
+
+      HugePageMode mode() const
+      {
+        return mode_;
+      }
+
+    private:
+      HugePageMode mode_;
+    };
+
+    // any instance can deallocate memory allocated by another
+    template<typename T, typename U>
+    bool operator==(const HugePageAllocator<T> &, const HugePageAllocator<U> &)
+    {
+      return true;
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const HugePageAllocator<T> & a, const HugePageAllocator<U> & b)
+    {
+      return !(a == b);
+    }
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSHUGEPAGEALLOCATOR_HEADER_
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSLASTVALUECACHE_HEADER_
+#define EMANESPECTRUMTOOLSLASTVALUECACHE_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class LastValueCache
+     *
+     * @brief Holds the most recent serialized message published on
+     * each topic, replayed to subscribers as they join.
+     *
+     * Entry storage is reused across updates, so a steady set of
+     * topics does not allocate once each entry has grown to its
+     * largest message.
+     */
+    class LastValueCache
+    {
+    public:
+      LastValueCache();
+
+      void update(const std::string & sTopic,
+                  const std::uint8_t * pData,
+                  std::size_t length);
+
+      /**
+       * Visits each cached topic starting with a prefix
+       *
+       * @param sPrefix Subscription prefix, empty matches all topics
+       * @param function Callable taking the topic and the cached
+       * message
+       */
+      template<typename Function>
+      void forEach(const std::string & sPrefix, Function function) const;
+
+      std::size_t getCommittedBytes() const;
+
+    private:
+      std::map<std::string,std::vector<std::uint8_t>> entries_;
+    };
+  }
+}
+
+template<typename Function>
+void EMANE::SpectrumTools::LastValueCache::forEach(const std::string & sPrefix,
+                                                   Function function) const
+{
+  // topics sharing a prefix are adjacent in key order
+  for(auto iter = entries_.lower_bound(sPrefix);
+      iter != entries_.end() && !iter->first.compare(0,sPrefix.size(),sPrefix);
+      ++iter)
+    {
+      function(iter->first,iter->second);
+    }
+}
+
+#endif // EMANESPECTRUMTOOLSLASTVALUECACHE_HEADER_
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lastvaluecacheserver.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <zmq.h>
+
+namespace
+{
+  // bounds how long stop() waits on an idle worker
+  const long POLL_TIMEOUT_MILLISECONDS{100};
+}
+
+EMANE::SpectrumTools::LastValueCacheServer::LastValueCacheServer():
+  mutex_{},
+  cache_{},
+  pSocket_{},
+  thread_{},
+  bRunning_{},
+  sFirstTopic_{},
+  messages_{}{}
+
+EMANE::SpectrumTools::LastValueCacheServer::~LastValueCacheServer()
+{
+  stop();
+}
+
+void EMANE::SpectrumTools::LastValueCacheServer::start(void * pZMQContext,
+                                                       const std::string & sEndpoint,
+                                                       const std::string & sFirstTopic,
+                                                       const ThreadSchedule & schedule)
+{
+  if(!(pSocket_ = zmq_socket(pZMQContext,ZMQ_REP)))
+    {
+      throw std::runtime_error{std::string{"unable to create snapshot socket: "} +
+                               zmq_strerror(errno)};
+    }
+
+  if(zmq_bind(pSocket_,sEndpoint.c_str()) < 0)
+    {
+      std::string sError{zmq_strerror(errno)};
+
+      zmq_close(pSocket_);
+
+      pSocket_ = nullptr;
+
+      throw std::runtime_error{"unable to bind snapshot socket " + sEndpoint + ": " + sError};
+    }
+
+  sFirstTopic_ = sFirstTopic;
+
+  bRunning_ = true;
+
+  thread_ = std::thread{&LastValueCacheServer::run,this,schedule};
+}
+
+void EMANE::SpectrumTools::LastValueCacheServer::stop()
+{
+  bRunning_ = false;
+
+  if(thread_.joinable())
+    {
+      thread_.join();
+    }
+}
+
+void EMANE::SpectrumTools::LastValueCacheServer::update(const std::string & sTopic,
+                                                        const std::uint8_t * pData,
+                                                        std::size_t length)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  cache_.update(sTopic,pData,length);
+}
+
+std::size_t EMANE::SpectrumTools::LastValueCacheServer::getCommittedBytes() const
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  return cache_.getCommittedBytes();
+}
+
+std::uint64_t EMANE::SpectrumTools::LastValueCacheServer::getMessages() const
+{
+  return messages_.load(std::memory_order_relaxed);
+}
+
+void EMANE::SpectrumTools::LastValueCacheServer::run(ThreadSchedule schedule)
+{
+  applyThreadSchedule(schedule);
+
+  zmq_pollitem_t item{pSocket_,0,ZMQ_POLLIN,0};
+
+  std::vector<char> buf(1024);
+
+  while(bRunning_)
+    {
+      if(zmq_poll(&item,1,POLL_TIMEOUT_MILLISECONDS) <= 0 || !(item.revents & ZMQ_POLLIN))
+        {
+          continue;
+        }
+
+      int iLength{zmq_recv(pSocket_,buf.data(),buf.size(),0)};
+
+      if(iLength < 0)
+        {
+          continue;
+        }
+
+      std::string sPrefix{buf.data(),
+                          std::min(static_cast<std::size_t>(iLength),buf.size())};
+
+      // a REP socket must consume the whole request before replying
+      int iMore{};
+      size_t moreSize{sizeof(iMore)};
+
+      while(!zmq_getsockopt(pSocket_,ZMQ_RCVMORE,&iMore,&moreSize) && iMore)
+        {
+          zmq_recv(pSocket_,buf.data(),buf.size(),0);
+        }
+
+      reply(sPrefix);
+    }
+
+  zmq_close(pSocket_);
+
+  pSocket_ = nullptr;
+}
+
+void EMANE::SpectrumTools::LastValueCacheServer::reply(const std::string & sPrefix)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  std::vector<std::pair<const std::string *,const std::vector<std::uint8_t> *>> entries{};
+
+  auto collect = [&entries](const std::string & sTopic,
+                            const std::vector<std::uint8_t> & message)
+                 {
+                   entries.emplace_back(&sTopic,&message);
+                 };
+
+  // a client joining a stream needs the metadata its messages
+  // reference, whatever prefix it asked for
+  cache_.forEach(sFirstTopic_,collect);
+
+  cache_.forEach(sPrefix,
+                 [this,&collect](const std::string & sTopic,
+                                 const std::vector<std::uint8_t> & message)
+                 {
+                   if(sTopic.compare(0,sFirstTopic_.size(),sFirstTopic_))
+                     {
+                       collect(sTopic,message);
+                     }
+                 });
+
+  if(entries.empty())
+    {
+      zmq_send(pSocket_,nullptr,0,0);
+
+      return;
+    }
+
+  for(std::size_t i = 0; i < entries.size(); ++i)
+    {
+      zmq_send(pSocket_,entries[i].first->c_str(),entries[i].first->size(),ZMQ_SNDMORE);
+
+      zmq_send(pSocket_,
+               entries[i].second->data(),
+               entries[i].second->size(),
+               i + 1 < entries.size() ? ZMQ_SNDMORE : 0);
+    }
+
+  messages_ += entries.size();
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSLASTVALUECACHESERVER_HEADER_
+#define EMANESPECTRUMTOOLSLASTVALUECACHESERVER_HEADER_
+
+#include "lastvaluecache.h"
+#include "threadschedule.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class LastValueCacheServer
+     *
+     * @brief Answers snapshot requests from a last value cache on a
+     * REP socket serviced by a worker thread.
+     *
+     * A request is a single frame holding a subscription prefix,
+     * empty for all topics. The reply is a topic frame and message
+     * frame pair for each cached topic matching the prefix, with
+     * entries matching the first topic sent ahead of the rest, or a
+     * single empty frame when nothing matches. Only the requesting
+     * peer receives the reply.
+     */
+    class LastValueCacheServer
+    {
+    public:
+      LastValueCacheServer();
+
+      ~LastValueCacheServer();
+
+      /**
+       * Binds the snapshot socket and starts the worker
+       *
+       * @param pZMQContext ZMQ context
+       * @param sEndpoint Bind endpoint
+       * @param sFirstTopic Topic prefix whose entries lead each
+       * reply, regardless of the requested prefix
+       * @param schedule Worker thread schedule
+       *
+       * @throw std::runtime_error
+       */
+      void start(void * pZMQContext,
+                 const std::string & sEndpoint,
+                 const std::string & sFirstTopic,
+                 const ThreadSchedule & schedule);
+
+      void stop();
+
+      void update(const std::string & sTopic,
+                  const std::uint8_t * pData,
+                  std::size_t length);
+
+      std::size_t getCommittedBytes() const;
+
+      // @return cumulative cached messages sent in replies
+      std::uint64_t getMessages() const;
+
+    private:
+      mutable std::mutex mutex_;
+      LastValueCache cache_;
+      void * pSocket_;
+      std::thread thread_;
+      std::atomic<bool> bRunning_;
+      std::string sFirstTopic_;
+      std::atomic<std::uint64_t> messages_;
+
+      void run(ThreadSchedule schedule);
+
+      void reply(const std::string & sPrefix);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSLASTVALUECACHESERVER_HEADER_
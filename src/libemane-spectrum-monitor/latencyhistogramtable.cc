@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "latencyhistogramtable.h"
+
+#include <cstdio>
+
+namespace
+{
+  const char * STAGE_NAMES[] =
+    {
+      "Upstream Packet",
+      "Location Lookup",
+      "Receive Process",
+      "Pathloss",
+      "Gain",
+      "Fading",
+      "Spectrum Update",
+      "Query",
+      "Serialize",
+      "Send",
+    };
+
+  std::string formatBound(std::uint64_t u64Nanoseconds)
+  {
+    char buf[32];
+
+    if(u64Nanoseconds < 1000)
+      {
+        std::snprintf(buf,sizeof(buf),"%juns",static_cast<std::uintmax_t>(u64Nanoseconds));
+      }
+    else if(u64Nanoseconds < 1000000)
+      {
+        std::snprintf(buf,sizeof(buf),"%.1fus",u64Nanoseconds / 1e3);
+      }
+    else
+      {
+        std::snprintf(buf,sizeof(buf),"%.1fms",u64Nanoseconds / 1e6);
+      }
+
+    return buf;
+  }
+}
+
+EMANE::SpectrumTools::LatencyHistogramTable::LatencyHistogramTable():
+  histograms_{},
+  baselines_{},
+  bRowsPresent_{},
+  pLatencyHistogramTable_{}
+{
+  static_assert(sizeof(STAGE_NAMES) / sizeof(STAGE_NAMES[0]) == STAGE_COUNT,
+                "stage name missing");
+
+  for(auto & histogram : histograms_)
+    {
+      for(auto & bucket : histogram.buckets_)
+        {
+          bucket.store(0,std::memory_order_relaxed);
+        }
+
+      histogram.sumNanoseconds_.store(0,std::memory_order_relaxed);
+    }
+}
+
+void EMANE::SpectrumTools::LatencyHistogramTable::registerStatistics(StatisticRegistrar & statisticRegistrar)
+{
+  StatisticTableLabels labels{"Stage","Count","Mean (ns)"};
+
+  for(std::size_t i = 0; i < BUCKET_COUNT - 1; ++i)
+    {
+      labels.push_back("<" + formatBound(std::uint64_t{256} << i));
+    }
+
+  labels.push_back(">=" + formatBound(std::uint64_t{256} << (BUCKET_COUNT - 2)));
+
+  pLatencyHistogramTable_ =
+    statisticRegistrar.registerTable<std::string>("LatencyHistogramTable",
+                                                  labels,
+                                                  [this](StatisticTablePublisher * pTable)
+                                                  {
+                                                    std::lock_guard<std::mutex> m(mutex_);
+
+                                                    for(std::size_t i = 0; i < STAGE_COUNT; ++i)
+                                                      {
+                                                        baselines_[i] = snapshot(static_cast<Stage>(i));
+                                                      }
+
+                                                    pTable->clear();
+
+                                                    bRowsPresent_ = false;
+                                                  },
+                                                  "Processing latency histogram per stage, log2 scale"
+                                                  " buckets. Populated when stats.latencyhistogram.enable"
+                                                  " is on.");
+}
+
+void EMANE::SpectrumTools::LatencyHistogramTable::publish()
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  for(std::size_t i = 0; i < STAGE_COUNT; ++i)
+    {
+      auto current = snapshot(static_cast<Stage>(i));
+
+      std::uint64_t u64Count{};
+
+      std::vector<Any> row{Any{std::string{STAGE_NAMES[i]}},Any{std::uint64_t{}},Any{std::uint64_t{}}};
+
+      for(std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+          auto u64BucketCount = current[bucket] - baselines_[i][bucket];
+
+          u64Count += u64BucketCount;
+
+          row.push_back(Any{u64BucketCount});
+        }
+
+      row[1] = Any{u64Count};
+
+      if(u64Count)
+        {
+          row[2] = Any{(current[BUCKET_COUNT] - baselines_[i][BUCKET_COUNT]) / u64Count};
+        }
+
+      if(bRowsPresent_)
+        {
+          pLatencyHistogramTable_->setRow(STAGE_NAMES[i],row);
+        }
+      else
+        {
+          pLatencyHistogramTable_->addRow(STAGE_NAMES[i],row);
+        }
+    }
+
+  bRowsPresent_ = true;
+}
+
+EMANE::SpectrumTools::LatencyHistogramTable::Snapshot
+EMANE::SpectrumTools::LatencyHistogramTable::snapshot(Stage stage) const
+{
+  Snapshot snapshot{};
+
+  const auto & histogram = histograms_[stage];
+
+  for(std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+      snapshot[bucket] = histogram.buckets_[bucket].load(std::memory_order_relaxed);
+    }
+
+  snapshot[BUCKET_COUNT] = histogram.sumNanoseconds_.load(std::memory_order_relaxed);
+
+  return snapshot;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSLATENCYHISTOGRAMTABLE_HEADER_
+#define EMANESPECTRUMTOOLSLATENCYHISTOGRAMTABLE_HEADER_
+
+#include "emane/statisticregistrar.h"
+#include "emane/statistictable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class LatencyHistogramTable
+     *
+     * @brief Per-stage processing latency histograms published as the
+     * LatencyHistogramTable statistic table.
+     *
+     * Each stage keeps a fixed set of log2 scale buckets, the first
+     * covering less than 256ns and each following bucket doubling the
+     * upper bound, the last bucket holding everything beyond. Recording
+     * is a relaxed atomic increment and may happen on any thread.
+     * publish() copies the histograms into the table, clearing the
+     * table rebases the histograms to zero and the rows reappear on the
+     * next publish().
+     */
+    class LatencyHistogramTable
+    {
+    public:
+      enum Stage : std::size_t
+        {
+          STAGE_UPSTREAM_PACKET,
+          STAGE_LOCATION_LOOKUP,
+          STAGE_RECEIVE_PROCESS,
+          STAGE_PATHLOSS,
+          STAGE_GAIN,
+          STAGE_FADING,
+          STAGE_SPECTRUM_UPDATE,
+          STAGE_QUERY,
+          STAGE_SERIALIZE,
+          STAGE_SEND,
+          STAGE_COUNT,
+        };
+
+      static const std::size_t BUCKET_COUNT{20};
+
+      using StageClock = std::chrono::steady_clock;
+
+      LatencyHistogramTable();
+
+      void registerStatistics(StatisticRegistrar & statisticRegistrar);
+
+      void record(Stage stage, const StageClock::duration & duration)
+      {
+        auto u64Nanoseconds =
+          static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+
+        auto & histogram = histograms_[stage];
+
+        histogram.buckets_[bucketIndex(u64Nanoseconds)].fetch_add(1,std::memory_order_relaxed);
+
+        histogram.sumNanoseconds_.fetch_add(u64Nanoseconds,std::memory_order_relaxed);
+      }
+
+      void publish();
+
+      /**
+       * @class StageTimer
+       *
+       * @brief Records the time between successive marks. A timer
+       * without a table does not read the clock.
+       */
+      class StageTimer
+      {
+      public:
+        explicit StageTimer(LatencyHistogramTable * pLatencyHistogramTable):
+          pLatencyHistogramTable_{pLatencyHistogramTable},
+          last_{pLatencyHistogramTable ? StageClock::now() : StageClock::time_point{}}{}
+
+        void restart()
+        {
+          if(pLatencyHistogramTable_)
+            {
+              last_ = StageClock::now();
+            }
+        }
+
+        void mark(Stage stage)
+        {
+          if(pLatencyHistogramTable_)
+            {
+              auto now = StageClock::now();
+
+              pLatencyHistogramTable_->record(stage,now - last_);
+
+              last_ = now;
+            }
+        }
+
+      private:
+        LatencyHistogramTable * pLatencyHistogramTable_;
+        StageClock::time_point last_;
+      };
+
+    private:
+      struct Histogram
+      {
+        std::array<std::atomic<std::uint64_t>,BUCKET_COUNT> buckets_;
+        std::atomic<std::uint64_t> sumNanoseconds_;
+      };
+
+      // bucket counts followed by the nanosecond sum
+      using Snapshot = std::array<std::uint64_t,BUCKET_COUNT + 1>;
+
+      std::array<Histogram,STAGE_COUNT> histograms_;
+      std::array<Snapshot,STAGE_COUNT> baselines_;
+      std::mutex mutex_;
+      bool bRowsPresent_;
+      StatisticTable<std::string> * pLatencyHistogramTable_;
+
+      static std::size_t bucketIndex(std::uint64_t u64Nanoseconds)
+      {
+        std::uint64_t u64Scaled{u64Nanoseconds >> 8};
+
+        if(!u64Scaled)
+          {
+            return 0;
+          }
+
+        std::size_t index = 64 - __builtin_clzll(u64Scaled);
+
+        return index < BUCKET_COUNT ? index : BUCKET_COUNT - 1;
+      }
+
+      Snapshot snapshot(Stage stage) const;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSLATENCYHISTOGRAMTABLE_HEADER_
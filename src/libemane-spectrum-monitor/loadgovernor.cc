@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "loadgovernor.h"
+
+#include <algorithm>
+
+EMANE::SpectrumTools::LoadGovernor::LoadGovernor():
+  u16MaxLevel_{},
+  dHighWatermark_{1},
+  dLowWatermark_{},
+  u16RecoveryCycles_{1},
+  u16Level_{},
+  u16CyclesBelowLow_{},
+  processingDuration_{}{}
+
+void EMANE::SpectrumTools::LoadGovernor::configure(std::uint16_t u16MaxLevel,
+                                                   double dHighWatermark,
+                                                   double dLowWatermark,
+                                                   std::uint16_t u16RecoveryCycles)
+{
+  u16MaxLevel_ = u16MaxLevel;
+  dHighWatermark_ = dHighWatermark;
+  dLowWatermark_ = dLowWatermark;
+  u16RecoveryCycles_ = std::max<std::uint16_t>(u16RecoveryCycles,1);
+  u16Level_ = std::min(u16Level_,u16MaxLevel_);
+  u16CyclesBelowLow_ = 0;
+}
+
+void EMANE::SpectrumTools::LoadGovernor::addProcessingTime(const Microseconds & processingDuration)
+{
+  processingDuration_ += processingDuration;
+}
+
+std::uint16_t EMANE::SpectrumTools::LoadGovernor::evaluate(const Microseconds & queryRate,
+                                                           const Microseconds & lateness)
+{
+  double dRate = queryRate.count();
+
+  double dPressure{std::max(processingDuration_.count() / dRate,
+                            lateness.count() / dRate)};
+
+  processingDuration_ = Microseconds::zero();
+
+  if(dPressure >= dHighWatermark_)
+    {
+      u16CyclesBelowLow_ = 0;
+
+      if(u16Level_ < u16MaxLevel_)
+        {
+          ++u16Level_;
+        }
+    }
+  else if(dPressure < dLowWatermark_)
+    {
+      if(u16Level_ && ++u16CyclesBelowLow_ >= u16RecoveryCycles_)
+        {
+          --u16Level_;
+
+          u16CyclesBelowLow_ = 0;
+        }
+    }
+  else
+    {
+      u16CyclesBelowLow_ = 0;
+    }
+
+  return u16Level_;
+}
+
+std::uint16_t EMANE::SpectrumTools::LoadGovernor::getLevel() const
+{
+  return u16Level_;
+}
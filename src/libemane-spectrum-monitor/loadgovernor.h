@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSLOADGOVERNOR_HEADER_
+#define EMANESPECTRUMTOOLSLOADGOVERNOR_HEADER_
+
+#include "emane/types.h"
+
+#include <cstdint>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class LoadGovernor
+     *
+     * @brief Tracks NEM thread load once per spectrum query cycle and
+     * selects a degradation level.
+     *
+     * Cycle pressure is the larger of the processing time accumulated
+     * during the cycle and the query lateness, each as a fraction of
+     * the query rate. The level is raised by one for every cycle at or
+     * above the high watermark and lowered by one after recoveryCycles
+     * consecutive cycles below the low watermark.
+     */
+    class LoadGovernor
+    {
+    public:
+      LoadGovernor();
+
+      void configure(std::uint16_t u16MaxLevel,
+                     double dHighWatermark,
+                     double dLowWatermark,
+                     std::uint16_t u16RecoveryCycles);
+
+      void addProcessingTime(const Microseconds & processingDuration);
+
+      /**
+       * Evaluates the cycle that just completed
+       *
+       * @param queryRate Spectrum query rate
+       * @param lateness Difference between the time the query ran and
+       * the time it was scheduled
+       *
+       * @return Degradation level to use for the next query
+       */
+      std::uint16_t evaluate(const Microseconds & queryRate,
+                             const Microseconds & lateness);
+
+      std::uint16_t getLevel() const;
+
+    private:
+      std::uint16_t u16MaxLevel_;
+      double dHighWatermark_;
+      double dLowWatermark_;
+      std::uint16_t u16RecoveryCycles_;
+      std::uint16_t u16Level_;
+      std::uint16_t u16CyclesBelowLow_;
+      Microseconds processingDuration_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSLOADGOVERNOR_HEADER_
@@ -38,14 +38,19 @@
 #include "emane/spectrumserviceexception.h"
 
 #include <algorithm>
+#include <numeric>
+#include <utility>
 
 namespace EMANE
 {
   namespace SpectrumTools
   {
-    double maxNoiseBin(const SpectrumWindow & window,
-                       const TimePoint & startTime,
-                       const TimePoint & endTime)
+    // window bin index range [first, second] covering startTime to
+    // endTime, or to the end of the window when endTime is min
+    inline std::pair<std::size_t,std::size_t>
+    noiseBinRange(const SpectrumWindow & window,
+                  const TimePoint & startTime,
+                  const TimePoint & endTime)
     {
       const auto & noiseData = std::get<0>(window);
       const TimePoint & windowStartTime = std::get<1>(window);
@@ -94,7 +99,30 @@ namespace EMANE
                                                         noiseData.size());
         }
 
-      return *std::max_element(&noiseData[startIndex],&noiseData[endIndex]+1);
+      return {startIndex,endIndex};
+    }
+
+    inline double maxNoiseBin(const SpectrumWindow & window,
+                              const TimePoint & startTime,
+                              const TimePoint & endTime)
+    {
+      const auto & noiseData = std::get<0>(window);
+
+      auto range = noiseBinRange(window,startTime,endTime);
+
+      return *std::max_element(&noiseData[range.first],&noiseData[range.second]+1);
+    }
+
+    inline double meanNoiseBin(const SpectrumWindow & window,
+                               const TimePoint & startTime,
+                               const TimePoint & endTime)
+    {
+      const auto & noiseData = std::get<0>(window);
+
+      auto range = noiseBinRange(window,startTime,endTime);
+
+      return std::accumulate(&noiseData[range.first],&noiseData[range.second]+1,0.0) /
+        (range.second - range.first + 1);
     }
   }
 }
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "memorytablepublisher.h"
+
+namespace
+{
+  struct ComponentInfo
+  {
+    const char * pzName_;
+    const char * pzStatistic_;
+    const char * pzDescription_;
+  };
+
+  const ComponentInfo COMPONENTS[] =
+    {
+      {"Noise Recorder",
+       "memoryNoiseRecorderBytes",
+       "Bytes committed by the noise recorder windows of all sub-ids and frequencies."},
+      {"Receive Processor",
+       "memoryReceiveProcessorBytes",
+       "Bytes held by the receive processors of all sub-ids."},
+      {"Gain Grid",
+       "memoryGainGridBytes",
+       "Bytes held by the antenna gain grids."},
+      {"Event Table Stager",
+       "memoryEventTableStagerBytes",
+       "Estimated bytes held by staged and published event table entries."},
+      {"Last Value Cache",
+       "memoryLastValueCacheBytes",
+       "Bytes held by the last value cache of published spectrum energy messages."},
+      {"Retained History",
+       "memoryRetainedHistoryBytes",
+       "Bytes held by the retained history tiers of published spectrum energy summaries."},
+    };
+}
+
+EMANE::SpectrumTools::MemoryTablePublisher::MemoryTablePublisher():
+  entries_{},
+  pMemoryTable_{},
+  componentBytes_{},
+  pTotalBytes_{}
+{
+  static_assert(sizeof(COMPONENTS) / sizeof(COMPONENTS[0]) == COMPONENT_COUNT,
+                "component info missing");
+}
+
+void EMANE::SpectrumTools::MemoryTablePublisher::registerStatistics(StatisticRegistrar & statisticRegistrar)
+{
+  pMemoryTable_ =
+    statisticRegistrar.registerTable<std::string>("MemoryTable",
+                                                  {"Component","SubId","Frequency","Bytes"},
+                                                  StatisticProperties::NONE,
+                                                  "Bytes held per component, sub-id and frequency.");
+
+  for(std::size_t i = 0; i < COMPONENT_COUNT; ++i)
+    {
+      componentBytes_[i] =
+        statisticRegistrar.registerNumeric<std::uint64_t>(COMPONENTS[i].pzStatistic_,
+                                                          StatisticProperties::NONE,
+                                                          COMPONENTS[i].pzDescription_);
+    }
+
+  pTotalBytes_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("memoryTotalBytes",
+                                                      StatisticProperties::NONE,
+                                                      "Total bytes held by all accounted components.");
+}
+
+void EMANE::SpectrumTools::MemoryTablePublisher::update(Component component,
+                                                        std::uint16_t u16SubId,
+                                                        std::uint64_t u64FrequencyHz,
+                                                        std::size_t bytes)
+{
+  auto & entry = entries_[Key{component,u16SubId,u64FrequencyHz}];
+
+  if(entry.bytes_ != bytes || !entry.bPublished_)
+    {
+      entry.bytes_ = bytes;
+      entry.bChanged_ = true;
+    }
+}
+
+std::size_t EMANE::SpectrumTools::MemoryTablePublisher::publish()
+{
+  std::array<std::size_t,COMPONENT_COUNT> componentBytes{};
+
+  for(auto & element : entries_)
+    {
+      auto component = std::get<0>(element.first);
+      auto u16SubId = std::get<1>(element.first);
+      auto u64FrequencyHz = std::get<2>(element.first);
+      auto & entry = element.second;
+
+      componentBytes[component] += entry.bytes_;
+
+      if(entry.bChanged_)
+        {
+          std::string sKey{std::string{COMPONENTS[component].pzName_} +
+              ":" + std::to_string(u16SubId) +
+              ":" + std::to_string(u64FrequencyHz)};
+
+          std::vector<Any> row{Any{std::string{COMPONENTS[component].pzName_}},
+                               Any{std::uint64_t{u16SubId}},
+                               Any{u64FrequencyHz},
+                               Any{std::uint64_t{entry.bytes_}}};
+
+          if(entry.bPublished_)
+            {
+              pMemoryTable_->setRow(sKey,row);
+            }
+          else
+            {
+              pMemoryTable_->addRow(sKey,row);
+
+              entry.bPublished_ = true;
+            }
+
+          entry.bChanged_ = false;
+        }
+    }
+
+  std::size_t totalBytes{};
+
+  for(std::size_t i = 0; i < COMPONENT_COUNT; ++i)
+    {
+      *componentBytes_[i] = componentBytes[i];
+
+      totalBytes += componentBytes[i];
+    }
+
+  *pTotalBytes_ = totalBytes;
+
+  return totalBytes;
+}
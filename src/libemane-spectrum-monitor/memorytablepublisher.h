@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSMEMORYTABLEPUBLISHER_HEADER_
+#define EMANESPECTRUMTOOLSMEMORYTABLEPUBLISHER_HEADER_
+
+#include "emane/statisticregistrar.h"
+#include "emane/statistictable.h"
+#include "emane/statisticnumeric.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class MemoryTablePublisher
+     *
+     * @brief Publishes bytes held per component, sub-id and frequency
+     * in the MemoryTable, with a total statistic per component.
+     *
+     * Entries are replaced by each update() and published together
+     * by publish(). Sub-id and frequency are 0 for components that are
+     * not per sub-id or per frequency.
+     */
+    class MemoryTablePublisher
+    {
+    public:
+      enum Component : std::size_t
+        {
+          COMPONENT_NOISE_RECORDER,
+          COMPONENT_RECEIVE_PROCESSOR,
+          COMPONENT_GAIN_GRID,
+          COMPONENT_EVENT_TABLE_STAGER,
+          COMPONENT_LAST_VALUE_CACHE,
+          COMPONENT_RETAINED_HISTORY,
+          COMPONENT_COUNT,
+        };
+
+      MemoryTablePublisher();
+
+      void registerStatistics(StatisticRegistrar & statisticRegistrar);
+
+      void update(Component component,
+                  std::uint16_t u16SubId,
+                  std::uint64_t u64FrequencyHz,
+                  std::size_t bytes);
+
+      // @return total bytes across all components
+      std::size_t publish();
+
+    private:
+      using Key = std::tuple<Component,
+                             std::uint16_t, // sub id
+                             std::uint64_t>; // frequency Hz
+
+      struct Entry
+      {
+        std::size_t bytes_{};
+        bool bPublished_{};
+        bool bChanged_{};
+      };
+
+      std::map<Key,Entry> entries_;
+      StatisticTable<std::string> * pMemoryTable_;
+      std::array<StatisticNumeric<std::uint64_t> *,COMPONENT_COUNT> componentBytes_;
+      StatisticNumeric<std::uint64_t> * pTotalBytes_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSMEMORYTABLEPUBLISHER_HEADER_
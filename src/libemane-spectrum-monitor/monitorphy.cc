@@ -69,13 +69,17 @@
 #include "tworaypropagationmodelalgorithm.h"
 #include "precomputedpropagationmodelalgorithm.h"
 #include "spectrumservice.h"
+#include "traceprobes.h"
+#include "maxnoisebin.h"
 
 #include "spectrummonitor.pb.h"
-#include "maxnoisebin.h"
 
 #include <iterator>
 #include <zmq.h>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <iterator>
 
 namespace
@@ -111,6 +115,50 @@ namespace
     "Missing Control"};
 
   const std::string FADINGMANAGER_PREFIX{"fading."};
+
+  const std::string SPECTRUM_ENERGY_TOPIC{"EMANE.SpectrumTools.MonitorPhy.SpectrumEnergy"};
+
+  // appended to every spectrum energy topic when compression is
+  // enabled. A prefix subscription, such as SpectrumEnergy, still
+  // matches the suffixed topics, so subscribers wanting only
+  // compressed frames subscribe to the exact topic and others check
+  // each frame for the zstd magic, as the python streamer does
+  const std::string COMPRESSED_TOPIC_SUFFIX{"zstd"};
+
+  const std::size_t COMPRESSION_QUEUE_DEPTH{1024};
+
+  const std::string SPECTRUM_METADATA_TOPIC{"EMANE.SpectrumTools.MonitorPhy.SpectrumMetadata"};
+
+  // set in the length prefix of recorded SpectrumMetadata messages
+  const std::uint32_t METADATA_FRAME_FLAG{0x80000000};
+
+  // bounds the history requests answered each spectrumquery.rate,
+  // fewer are answered once spectrumquery.history.maxnoisebins noise
+  // bins have been charged in a cycle
+  const std::size_t HISTORY_REQUESTS_PER_CYCLE{4};
+
+  // bounds the retained messages returned for a single gap fill
+  const std::size_t RETAINED_MESSAGES_PER_RESULT{1000};
+
+  // subscriptions are drained at this interval in addition to every
+  // spectrumquery.rate, so a slow query rate does not delay them
+  const EMANE::Microseconds SUBSCRIPTION_INTERVAL{100000};
+
+  void addEnergy(EMANESpectrumMonitor::SpectrumEnergy::Entry * pEntry,
+                 const std::pair<std::uint64_t,std::vector<double>> & summary,
+                 std::size_t firstBin = 0)
+  {
+    auto pEnergy = pEntry->add_energies();
+
+    pEnergy->set_frequency_hz(summary.first);
+
+    pEnergy->mutable_energy_mw()->Reserve(summary.second.size() - firstBin);
+
+    for(std::size_t i = firstBin; i < summary.second.size(); ++i)
+      {
+        pEnergy->add_energy_mw(summary.second[i]);
+      }
+  }
 }
 
 EMANE::SpectrumTools::MonitorPhy::MonitorPhy(NEMId id,
@@ -119,22 +167,100 @@ EMANE::SpectrumTools::MonitorPhy::MonitorPhy(NEMId id,
   pSpectrumService_{new SpectrumService{}},
   antennaManager_{},
   locationManager_{id},
+  gainManager_{id,DEFAULT_ANTENNA_INDEX,antennaManager_},
+  gainGridManager_{id,DEFAULT_ANTENNA_INDEX,antennaManager_,gainManager_},
+  bAntennaGainGridEnable_{},
   u64BandwidthHz_{},
   u64RxCenterFrequencyHz_{},
   u64SubbandBinSizeHz_{},
+  receiveProcessorAltFactory_{},
   commonLayerStatistics_{STATISTIC_TABLE_LABELS,{},"0"},
   eventTablePublisher_{id},
+  eventTableStager_{eventTablePublisher_},
+  eventTableRefreshInterval_{},
+  lastEventTableRefreshTime_{},
   noiseBinSize_{},
   maxSegmentOffset_{},
   maxMessagePropagation_{},
   maxSegmentDuration_{},
   timeSyncThreshold_{},
   bNoiseMaxClamp_{},
+  noiseRecorderBackendType_{NoiseRecorderBackend::Type::MAP},
+  noiseRecorderHugePageMode_{HugePageMode::NONE},
   dSystemNoiseFiguredB_{},
   pTimeSyncThresholdRewrite_{},
   pGainCacheHit_{},
   pGainCacheMiss_{},
-  fadingManager_{id, pPlatformService,FADINGMANAGER_PREFIX}{}
+  pSpectrumClampOffset_{},
+  pSpectrumClampDuration_{},
+  pSpectrumClampPropagation_{},
+  pNakagamiPoolDirectDraws_{},
+  pDegradationLevel_{},
+  pSpectrumQuerySkipped_{},
+  pSpectrumSubscriptions_{},
+  pLastValueCacheReplays_{},
+  pSpectrumEnergyRingOversize_{},
+  pSpectrumHistoryQueries_{},
+  pSpectrumHistoryQueryErrors_{},
+  pSpectrumHistoryGapFills_{},
+  pRetainedHistoryDuration_{},
+  pStreamingRevisions_{},
+  pCompressedMessages_{},
+  pCompressionDrops_{},
+  pCompressionCPUTime_{},
+  pCompressionRatio_{},
+  statisticCounterShards_{COUNTER_COUNT},
+  latencyHistogramTable_{},
+  bLatencyHistogramEnable_{},
+  fadingManager_{id, pPlatformService,FADINGMANAGER_PREFIX},
+  u64NakagamiVariatePoolSize_{},
+  pNakagamiVariatePool_{},
+  loadGovernor_{},
+  bLoadGovernorEnable_{},
+  memoryReportFrequencyCount_{},
+  memoryTablePublisher_{},
+  memoryRefreshInterval_{},
+  lastMemoryRefreshTime_{},
+  serializationBufferPool_{},
+  arenaBlock_{},
+  publishMode_{PublishMode::SINGLE},
+  u64FrequencyBlockSizeHz_{},
+  subIdTopics_{},
+  spectrumEnergyTopics_{},
+  subscriptionTracker_{},
+  bLastValueCacheEnable_{},
+  lastValueCacheAddr_{},
+  lastValueCacheServer_{},
+  u64LastValueCacheMessages_{},
+  sSpectrumEnergyRingName_{},
+  u64SpectrumEnergyRingSize_{},
+  spectrumEnergyRingWriter_{},
+  sSpectrumEnergyTopic_{SPECTRUM_ENERGY_TOPIC},
+  zmqSocketMutex_{},
+  bCompressionEnable_{},
+  iCompressionLevel_{},
+  sCompressionDictionaryFile_{},
+  spectrumEnergyCompressor_{},
+  compressionCounters_{},
+  bMetadataEnable_{},
+  metadataRefreshInterval_{},
+  u64MetadataVersion_{},
+  sMetadata_{},
+  sMetadataScratch_{},
+  lastMetadataPublishTime_{},
+  sSpectrumMetadataTopic_{SPECTRUM_METADATA_TOPIC},
+  bSpectrumHistoryEnable_{},
+  spectrumHistoryAddr_{},
+  u64SpectrumHistoryMaxBins_{},
+  u64SpectrumHistoryMaxQueries_{},
+  u64SpectrumHistoryMaxNoiseBins_{},
+  pPendingHistoryRequest_{},
+  pZMQHistorySocket_{},
+  u64RetentionTierSize_{},
+  u16RetentionTiers_{},
+  queryPeriod_{},
+  queryWatermark_{},
+  streamingBinTracker_{}{}
 
 
 EMANE::SpectrumTools::MonitorPhy::~MonitorPhy(){}
@@ -213,6 +339,69 @@ void EMANE::SpectrumTools::MonitorPhy::initialize(Registrar & registrar)
                                                   1,
                                                   "^(precomputed|2ray|freespace)$");
 
+  configRegistrar.registerNonNumeric<std::string>("noiserecorderbackend",
+                                                  EMANE::ConfigurationProperties::DEFAULT,
+                                                  {"map"},
+                                                  "Defines the noise recorder backend used to store binned"
+                                                  " receive energy for each subid: map, matrix or segmenttree."
+                                                  " map uses a separate noise recorder per frequency. matrix uses"
+                                                  " a single contiguous time bin by frequency energy matrix,"
+                                                  " allowing spectrum queries to sweep all frequencies at once."
+                                                  " segmenttree uses a per frequency segment tree with O(log n)"
+                                                  " range add and range max, favoring long segment durations"
+                                                  " with small noisebinsize values.",
+                                                  1,
+                                                  1,
+                                                  "^(map|matrix|segmenttree)$");
+
+  configRegistrar.registerNonNumeric<std::string>("noiserecorderhugepages",
+                                                  EMANE::ConfigurationProperties::DEFAULT,
+                                                  {"none"},
+                                                  "Defines whether matrix and segmenttree noise recorder storage"
+                                                  " of at least one huge page is backed by huge pages: none,"
+                                                  " transparent or explicit. transparent advises the kernel to use"
+                                                  " transparent huge pages. explicit uses reserved huge pages"
+                                                  " (vm.nr_hugepages), falling back to transparent when none are"
+                                                  " available. Huge page backed storage is pre-faulted.",
+                                                  1,
+                                                  1,
+                                                  "^(none|transparent|explicit)$");
+
+  configRegistrar.registerNumeric<bool>("antennagaingrid.enable",
+                                        EMANE::ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether antenna gain is determined using azimuth/elevation"
+                                        " gain grids built once per antenna profile with bilinear"
+                                        " interpolation, instead of evaluating antenna profile patterns"
+                                        " for each packet. Profiles with placement offsets and links near"
+                                        " the radio horizon use the exact antenna profile path.");
+
+  configRegistrar.registerNumeric<double>("antennagaingrid.resolution",
+                                          EMANE::ConfigurationProperties::DEFAULT,
+                                          {1.0},
+                                          "Defines the antenna gain grid resolution in degrees. Must evenly"
+                                          " divide 90.",
+                                          0.1,
+                                          90.0);
+
+  configRegistrar.registerNumeric<std::uint64_t>("antennagaingrid.accuracysamplerate",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {100},
+                                                 "Defines how often antenna gain grid results are compared"
+                                                 " against the exact antenna profile gain, as 1 in N gain"
+                                                 " determinations. See the GainGrid statistics. A value of 0"
+                                                 " disables sampling.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("nakagamivariatepoolsize",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {4096},
+                                                 "Defines the number of pre-generated nakagami fading variates"
+                                                 " kept for each fading.nakagami m value. Pools are refilled"
+                                                 " every spectrumquery.rate and all frequency segments of a"
+                                                 " transmitter are faded in a single batch. Variates are drawn"
+                                                 " directly when a pool is exhausted. A value of 0 disables"
+                                                 " the pools.");
+
   configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.rate",
                                                  EMANE::ConfigurationProperties::DEFAULT,
                                                  {100000},
@@ -228,16 +417,234 @@ void EMANE::SpectrumTools::MonitorPhy::initialize(Registrar & registrar)
                                                  " noisebinsize and <= spectrumquery.rate.",
                                                  1);
 
+  configRegistrar.registerNumeric<bool>("spectrumquery.streaming.enable",
+                                        EMANE::ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether each spectrumquery.binsize bin is published as"
+                                        " soon as it closes, plus spectrumquery.streaming.watermark,"
+                                        " instead of every spectrumquery.rate. The load governor has"
+                                        " no resolution to reduce when streaming.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.streaming.watermark",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {10000},
+                                                 "Defines the time in microseconds to wait after a streamed bin"
+                                                 " closes before publishing it, allowing for propagation and"
+                                                 " late over-the-air receptions.");
+
+  configRegistrar.registerNumeric<std::uint16_t>("spectrumquery.streaming.revisionbins",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {5},
+                                                 "Defines the number of streamed bins, before the bin being"
+                                                 " published, checked for changes caused by late receptions."
+                                                 " Changed bins are republished as a revision. 0 disables"
+                                                 " revisions.");
+
   configRegistrar.registerNonNumeric<INETAddr>("spectrumquery.publishendpoint",
                                                ConfigurationProperties::DEFAULT,
                                                {INETAddr{"0.0.0.0",8883}},
                                                "Spectrum Query ZMQ Pub socket endpoint.");
 
+  configRegistrar.registerNonNumeric<INETAddr>("spectrumquery.history.endpoint",
+                                               ConfigurationProperties::NONE,
+                                               {},
+                                               "Spectrum history ZMQ Rep socket endpoint. When set,"
+                                               " SpectrumHistoryRequest queries for energy retained by the"
+                                               " monitor are answered at any multiple of the noisebinsize,"
+                                               " checked every spectrumquery.rate.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.history.maxbins",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {10000},
+                                                 "Defines the maximum number of bins the queries of a single"
+                                                 " spectrum history request may request in total, bounding the"
+                                                 " size of a response.",
+                                                 1);
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.history.maxnoisebins",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {1000000},
+                                                 "Defines the maximum number of noise bins reduced answering"
+                                                 " spectrum history requests each spectrumquery.rate, bounding"
+                                                 " the time spent on the NEM processing thread. A query is"
+                                                 " charged its duration in noisebinsize bins for each frequency"
+                                                 " reduced. A request charged more is refused, a request that"
+                                                 " does not fit in what remains of a cycle waits for the next.",
+                                                 1);
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.history.maxqueries",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {16},
+                                                 "Defines the maximum number of queries and retained queries a"
+                                                 " single spectrum history request may contain.",
+                                                 1);
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.retention.tiersize",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {0},
+                                                 "Defines the size in bytes of each spectrum energy retention"
+                                                 " tier. Retained energy is returned by the"
+                                                 " spectrumquery.history.endpoint to fill subscriber gaps."
+                                                 " A value of 0 disables retention.");
+
+  configRegistrar.registerNumeric<std::uint16_t>("spectrumquery.retention.tiers",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {3},
+                                                 "Defines the number of spectrum energy retention tiers."
+                                                 " Tier 0 retains published energy as is, each following tier"
+                                                 " retains bins 10 times wider reduced using max.",
+                                                 1,
+                                                 SpectrumEnergyHistory::MAX_TIERS);
+
   configRegistrar.registerNonNumeric<std::string>("spectrumquery.recorderfile",
                                                   ConfigurationProperties::NONE,
                                                   {},
                                                   "Spectrum query measurement recorder file.");
 
+  configRegistrar.registerNonNumeric<std::string>("spectrumquery.publishmode",
+                                                  EMANE::ConfigurationProperties::DEFAULT,
+                                                  {"single"},
+                                                  "Defines how each spectrum query is published: single,"
+                                                  " subid or frequencyblock. single publishes all subids in"
+                                                  " one message. subid publishes one message per subid using"
+                                                  " the topic <prefix>.<subid>. and frequencyblock publishes"
+                                                  " one message per subid frequency block using the topic"
+                                                  " <prefix>.<subid>.<block start hz>., allowing subscribers"
+                                                  " to prefix filter.",
+                                                  1,
+                                                  1,
+                                                  "^(single|subid|frequencyblock)$");
+
+  configRegistrar.registerNonNumeric<std::string>("spectrumquery.shmring.name",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Defines the name of a shared memory ring, /dev/shm/<name>,"
+                                                  " every published spectrum energy message is also written to"
+                                                  " for co-located consumers. See spectrumenergyring.h.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.shmring.size",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {16777216},
+                                                 "Defines the shared memory ring size in bytes. Messages larger"
+                                                 " than half the ring are not written.",
+                                                 4096);
+
+  configRegistrar.registerNonNumeric<std::string>("spectrumquery.compression",
+                                                  EMANE::ConfigurationProperties::DEFAULT,
+                                                  {"none"},
+                                                  "Defines the compression applied to published spectrum energy"
+                                                  " messages: none or zstd. Compression runs on a dedicated"
+                                                  " thread and compressed messages are published with the"
+                                                  " topic suffix zstd. Recorder files and the shared memory"
+                                                  " ring are not compressed.",
+                                                  1,
+                                                  1,
+                                                  "^(none|zstd)$");
+
+  configRegistrar.registerNumeric<std::int32_t>("spectrumquery.compression.level",
+                                                EMANE::ConfigurationProperties::DEFAULT,
+                                                {3},
+                                                "Defines the zstd compression level. Lower levels trade"
+                                                " compression ratio for compression CPU time.",
+                                                1,
+                                                22);
+
+  configRegistrar.registerNonNumeric<std::string>("spectrumquery.compression.dictionary",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Defines a zstd dictionary file used to compress spectrum"
+                                                  " energy messages. Subscribers must decompress with the"
+                                                  " same dictionary. Trained dictionaries noticeably improve"
+                                                  " the ratio of small messages.");
+
+  configRegistrar.registerNumeric<bool>("spectrumquery.metadata.enable",
+                                        EMANE::ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether antenna, position, orientation, velocity and"
+                                        " subid bandwidth are published separately as versioned"
+                                        " SpectrumMetadata messages when they change, instead of in every"
+                                        " SpectrumEnergy message. Energy messages reference the metadata"
+                                        " version.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.metadata.refreshinterval",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {1000000},
+                                                 "Defines the interval in microseconds at which unchanged"
+                                                 " metadata is republished for resync, checked every"
+                                                 " spectrumquery.rate. 0 publishes metadata only when it"
+                                                 " changes.");
+
+  configRegistrar.registerNonNumeric<INETAddr>("spectrumquery.lastvaluecache.endpoint",
+                                               ConfigurationProperties::NONE,
+                                               {},
+                                               "Last value cache ZMQ Rep socket endpoint. When set, the"
+                                               " most recent message published on each topic is cached"
+                                               " and a request holding a subscription prefix is answered"
+                                               " with the cached metadata followed by the cached messages"
+                                               " matching the prefix, as topic and message frame pairs.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("spectrumquery.frequencyblocksize",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {100000000},
+                                                 "Defines the frequency block size in Hz used to group"
+                                                 " frequencies when spectrumquery.publishmode is"
+                                                 " frequencyblock. Blocks start at multiples of the block"
+                                                 " size.",
+                                                 1);
+
+  configRegistrar.registerNonNumeric<std::string>("threadschedule.nem",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Defines the CPU affinity and scheduling of the NEM processing"
+                                                  " thread as CPULIST[:POLICY[:PRIORITY]], where POLICY is other,"
+                                                  " batch, idle, fifo or rr. For example, 2:fifo:60.");
+
+  configRegistrar.registerNonNumeric<std::string>("threadschedule.zmq",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Defines the CPU affinity and scheduling of the ZMQ I/O threads"
+                                                  " as CPULIST[:POLICY[:PRIORITY]], where POLICY is other, batch,"
+                                                  " idle, fifo or rr. Applied when the ZMQ threads are created"
+                                                  " and to the spectrum energy compression thread.");
+
+  configRegistrar.registerNumeric<bool>("loadgovernor.enable",
+                                        EMANE::ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether spectrum query resolution is reduced when upstream"
+                                        " packet processing and spectrum queries fall behind real time. Each"
+                                        " degradation level doubles the spectrumquery.binsize.");
+
+  configRegistrar.registerNumeric<std::uint16_t>("loadgovernor.maxlevel",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {3},
+                                                 "Defines the maximum degradation level. Limited to the levels"
+                                                 " where the degraded bin size evenly divides spectrumquery.rate.");
+
+  configRegistrar.registerNumeric<double>("loadgovernor.highwatermark",
+                                          EMANE::ConfigurationProperties::DEFAULT,
+                                          {0.8},
+                                          "Defines the query cycle pressure, as a fraction of"
+                                          " spectrumquery.rate, at or above which the degradation level is"
+                                          " raised. Pressure is the larger of the processing time and the"
+                                          " query lateness during a cycle.",
+                                          0.01);
+
+  configRegistrar.registerNumeric<double>("loadgovernor.lowwatermark",
+                                          EMANE::ConfigurationProperties::DEFAULT,
+                                          {0.5},
+                                          "Defines the query cycle pressure, as a fraction of"
+                                          " spectrumquery.rate, below which the degradation level is"
+                                          " lowered after loadgovernor.recoverycycles consecutive cycles.",
+                                          0.0);
+
+  configRegistrar.registerNumeric<std::uint16_t>("loadgovernor.recoverycycles",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {10},
+                                                 "Defines the number of consecutive query cycles below"
+                                                 " loadgovernor.lowwatermark required to lower the degradation"
+                                                 " level.",
+                                                 1);
+
   configRegistrar.registerNumeric<bool>("stats.receivepowertableenable",
                                         EMANE::ConfigurationProperties::DEFAULT,
                                         {true},
@@ -245,6 +652,34 @@ void EMANE::SpectrumTools::MonitorPhy::initialize(Registrar & registrar)
                                         " of antenna (MIMO) and/or frequency segments will increases processing"
                                         " load when populating.");
 
+  configRegistrar.registerNumeric<bool>("stats.latencyhistogram.enable",
+                                        EMANE::ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether per stage processing latencies are timestamped and"
+                                        " published in the LatencyHistogramTable every spectrumquery.rate.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("stats.memory.refreshinterval",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {1000000},
+                                                 "Defines the interval in microseconds at which the MemoryTable and"
+                                                 " memory statistics are refreshed, checked every spectrumquery.rate."
+                                                 " 0 disables the refresh.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("stats.eventtable.refreshinterval",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {0},
+                                                 "Defines the event table refresh interval in microseconds. When"
+                                                 " non-zero, only changed location, pathloss, antenna profile and"
+                                                 " fading selection entries are staged and applied to the event"
+                                                 " tables in batches, checked every spectrumquery.rate. When 0,"
+                                                 " event tables are updated as each event is received.");
+
+  configRegistrar.registerNumeric<std::uint64_t>("stats.eventtable.maxrowsperrefresh",
+                                                 EMANE::ConfigurationProperties::DEFAULT,
+                                                 {1000},
+                                                 "Defines the maximum number of staged rows applied to each event"
+                                                 " table per refresh. Remaining rows are applied on subsequent"
+                                                 " refreshes. 0 applies all staged rows.");
 
   auto & eventRegistrar = registrar.eventRegistrar();
 
@@ -264,6 +699,10 @@ void EMANE::SpectrumTools::MonitorPhy::initialize(Registrar & registrar)
 
   receivePowerTablePublisher_.registerStatistics(statisticRegistrar);
 
+  latencyHistogramTable_.registerStatistics(statisticRegistrar);
+
+  memoryTablePublisher_.registerStatistics(statisticRegistrar);
+
   pTimeSyncThresholdRewrite_ =
     statisticRegistrar.registerNumeric<std::uint64_t>("numTimeSyncThresholdRewrite",
                                                       StatisticProperties::CLEARABLE);
@@ -275,6 +714,120 @@ void EMANE::SpectrumTools::MonitorPhy::initialize(Registrar & registrar)
     statisticRegistrar.registerNumeric<std::uint64_t>("numGainCacheMiss",
                                                       StatisticProperties::CLEARABLE);
 
+  pSpectrumClampOffset_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumClampOffset",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of messages with a segment offset greater than"
+                                                      " noisemaxsegmentoffset. Clamped when noisemaxclampenable"
+                                                      " is on, otherwise dropped as Spectrum Clamp.");
+
+  pSpectrumClampDuration_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumClampDuration",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of messages with a segment duration greater than"
+                                                      " noisemaxsegmentduration. Clamped when noisemaxclampenable"
+                                                      " is on, otherwise dropped as Spectrum Clamp.");
+
+  pSpectrumClampPropagation_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumClampPropagation",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of messages with a propagation delay greater than"
+                                                      " noisemaxmessagepropagation. Clamped when noisemaxclampenable"
+                                                      " is on, otherwise dropped as Spectrum Clamp.");
+
+  gainGridManager_.registerStatistics(statisticRegistrar);
+
+  pNakagamiPoolDirectDraws_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numNakagamiPoolDirectDraws",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of nakagami fading variates drawn directly because"
+                                                      " a variate pool was exhausted. Consider increasing"
+                                                      " nakagamivariatepoolsize when this grows.");
+
+  pDegradationLevel_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("degradationLevel",
+                                                      StatisticProperties::NONE,
+                                                      "Current load governor degradation level. The spectrum"
+                                                      " query bin size is spectrumquery.binsize * 2^level.");
+
+  pSpectrumQuerySkipped_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumQuerySkipped",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum queries skipped because no subscriber"
+                                                      " was subscribed to a published topic and no"
+                                                      " spectrumquery.recorderfile is configured.");
+
+  pLastValueCacheReplays_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numLastValueCacheReplays",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of cached messages sent in last value cache"
+                                                      " snapshot replies.");
+
+  pSpectrumEnergyRingOversize_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumEnergyRingOversize",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum energy messages not written to the"
+                                                      " shared memory ring because they exceed half of"
+                                                      " spectrumquery.shmring.size.");
+
+  pCompressedMessages_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numCompressedMessages",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum energy messages compressed when"
+                                                      " spectrumquery.compression is zstd.");
+
+  pCompressionDrops_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numCompressionDrops",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum energy messages dropped because the"
+                                                      " compression thread queue was full or compression failed.");
+
+  pCompressionCPUTime_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("compressionCPUTime",
+                                                      StatisticProperties::NONE,
+                                                      "Compression thread CPU time in microseconds.");
+
+  pCompressionRatio_ =
+    statisticRegistrar.registerNumeric<double>("compressionRatio",
+                                               StatisticProperties::NONE,
+                                               "Ratio of uncompressed to compressed spectrum energy bytes.");
+
+  pSpectrumHistoryQueries_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumHistoryQueries",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum history queries answered on the"
+                                                      " spectrumquery.history.endpoint.");
+
+  pSpectrumHistoryQueryErrors_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumHistoryQueryErrors",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of spectrum history queries answered with an"
+                                                      " error.");
+
+  pSpectrumHistoryGapFills_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numSpectrumHistoryGapFills",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of retained spectrum energy messages returned on"
+                                                      " the spectrumquery.history.endpoint.");
+
+  pRetainedHistoryDuration_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("retainedHistoryDuration",
+                                                      StatisticProperties::NONE,
+                                                      "Duration of spectrum energy retained by the coarsest"
+                                                      " retention tier in microseconds.");
+
+  pStreamingRevisions_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numStreamingRevisions",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of streamed spectrum energy revision messages"
+                                                      " published for bins changed by late receptions.");
+
+  pSpectrumSubscriptions_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("spectrumSubscriptions",
+                                                      StatisticProperties::NONE,
+                                                      "Number of distinct topic prefixes subscribed to on the"
+                                                      " spectrum query publish endpoint.");
+
   fadingManager_.initialize(registrar);
 }
 
@@ -282,6 +835,26 @@ void EMANE::SpectrumTools::MonitorPhy::configure(const ConfigurationUpdate & upd
 {
   ConfigurationUpdate fadingManagerConfiguration{};
 
+  bool bNakagamiFading{};
+
+  double dAntennaGainGridResolutionDegrees{1};
+
+  std::uint64_t u64AntennaGainGridAccuracySampleRate{};
+
+  std::uint16_t u16LoadGovernorMaxLevel{};
+
+  double dLoadGovernorHighWatermark{};
+
+  double dLoadGovernorLowWatermark{};
+
+  std::uint16_t u16LoadGovernorRecoveryCycles{};
+
+  bool bStreamingEnable{};
+
+  Microseconds streamingWatermark{};
+
+  std::uint16_t u16StreamingRevisionBins{};
+
   for(const auto & item : update)
     {
       if(item.first == "subbandbinsize")
@@ -347,6 +920,58 @@ void EMANE::SpectrumTools::MonitorPhy::configure(const ConfigurationUpdate & upd
                                   item.first.c_str(),
                                   sPropagationModel.c_str());
         }
+      else if(item.first == "noiserecorderbackend")
+        {
+          std::string sNoiseRecorderBackend{item.second[0].asString()};
+
+          // regex has already validated values
+          if(sNoiseRecorderBackend == "matrix")
+            {
+              noiseRecorderBackendType_ = NoiseRecorderBackend::Type::MATRIX;
+            }
+          else if(sNoiseRecorderBackend == "segmenttree")
+            {
+              noiseRecorderBackendType_ = NoiseRecorderBackend::Type::SEGMENTTREE;
+            }
+          else
+            {
+              noiseRecorderBackendType_ = NoiseRecorderBackend::Type::MAP;
+            }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sNoiseRecorderBackend.c_str());
+        }
+      else if(item.first == "noiserecorderhugepages")
+        {
+          std::string sNoiseRecorderHugePages{item.second[0].asString()};
+
+          // regex has already validated values
+          if(sNoiseRecorderHugePages == "transparent")
+            {
+              noiseRecorderHugePageMode_ = HugePageMode::TRANSPARENT;
+            }
+          else if(sNoiseRecorderHugePages == "explicit")
+            {
+              noiseRecorderHugePageMode_ = HugePageMode::EXPLICIT;
+            }
+          else
+            {
+              noiseRecorderHugePageMode_ = HugePageMode::NONE;
+            }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sNoiseRecorderHugePages.c_str());
+        }
       else if(item.first == "noisebinsize")
         {
           noiseBinSize_ = Microseconds{item.second[0].asUINT64()};
@@ -407,6 +1032,63 @@ void EMANE::SpectrumTools::MonitorPhy::configure(const ConfigurationUpdate & upd
                                   item.first.c_str(),
                                   maxSegmentDuration_.count());
         }
+      else if(item.first == "antennagaingrid.enable")
+        {
+          bAntennaGainGridEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bAntennaGainGridEnable_ ? "on" : "off");
+        }
+      else if(item.first == "antennagaingrid.resolution")
+        {
+          dAntennaGainGridResolutionDegrees = item.second[0].asDouble();
+
+          double dSteps{90 / dAntennaGainGridResolutionDegrees};
+
+          if(std::fabs(dSteps - std::round(dSteps)) > 1e-9)
+            {
+              throw makeException<ConfigureException>("MonitorPhy: %s %lf does not evenly divide 90",
+                                                      item.first.c_str(),
+                                                      dAntennaGainGridResolutionDegrees);
+            }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %lf degrees",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  dAntennaGainGridResolutionDegrees);
+        }
+      else if(item.first == "antennagaingrid.accuracysamplerate")
+        {
+          u64AntennaGainGridAccuracySampleRate = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64AntennaGainGridAccuracySampleRate);
+        }
+      else if(item.first == "nakagamivariatepoolsize")
+        {
+          u64NakagamiVariatePoolSize_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64NakagamiVariatePoolSize_);
+        }
       else if(item.first == "timesyncthreshold")
         {
           timeSyncThreshold_ = Microseconds{item.second[0].asUINT64()};
@@ -467,9 +1149,11 @@ void EMANE::SpectrumTools::MonitorPhy::configure(const ConfigurationUpdate & upd
                                   item.first.c_str(),
                                   spectrumQueryPublishAddr_.str().c_str());
         }
-      else if(item.first == "spectrumquery.recorderfile")
+      else if(item.first == "spectrumquery.history.endpoint")
         {
-          sSpectrumQueryRecorderFile_ = item.second[0].asString();
+          spectrumHistoryAddr_ = item.second[0].asINETAddr();
+
+          bSpectrumHistoryEnable_ = true;
 
           LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                   INFO_LEVEL,
@@ -477,423 +1161,1972 @@ void EMANE::SpectrumTools::MonitorPhy::configure(const ConfigurationUpdate & upd
                                   id_,
                                   __func__,
                                   item.first.c_str(),
-                                  sSpectrumQueryRecorderFile_.c_str());
+                                  spectrumHistoryAddr_.str().c_str());
         }
-      else if(item.first == "stats.receivepowertableenable")
+      else if(item.first == "spectrumquery.history.maxbins")
         {
-          bStatsReceivePowerTableEnable_ = item.second[0].asBool();
+          u64SpectrumHistoryMaxBins_ = item.second[0].asUINT64();
 
           LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                   INFO_LEVEL,
-                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju",
                                   id_,
                                   __func__,
                                   item.first.c_str(),
-                                  bStatsReceivePowerTableEnable_ ? "on" : "off");
+                                  u64SpectrumHistoryMaxBins_);
         }
-      else
+      else if(item.first == "spectrumquery.history.maxqueries")
         {
-          if(!item.first.compare(0,FADINGMANAGER_PREFIX.size(),FADINGMANAGER_PREFIX))
+          u64SpectrumHistoryMaxQueries_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64SpectrumHistoryMaxQueries_);
+        }
+      else if(item.first == "spectrumquery.history.maxnoisebins")
+        {
+          u64SpectrumHistoryMaxNoiseBins_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64SpectrumHistoryMaxNoiseBins_);
+        }
+      else if(item.first == "spectrumquery.retention.tiersize")
+        {
+          u64RetentionTierSize_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64RetentionTierSize_);
+        }
+      else if(item.first == "spectrumquery.retention.tiers")
+        {
+          u16RetentionTiers_ = item.second[0].asUINT16();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %hu",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u16RetentionTiers_);
+        }
+      else if(item.first == "spectrumquery.recorderfile")
+        {
+          sSpectrumQueryRecorderFile_ = item.second[0].asString();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sSpectrumQueryRecorderFile_.c_str());
+        }
+      else if(item.first == "spectrumquery.publishmode")
+        {
+          std::string sPublishMode{item.second[0].asString()};
+
+          // regex has already validated values
+          if(sPublishMode == "subid")
             {
-              fadingManagerConfiguration.push_back(item);
+              publishMode_ = PublishMode::SUBID;
+            }
+          else if(sPublishMode == "frequencyblock")
+            {
+              publishMode_ = PublishMode::FREQUENCY_BLOCK;
             }
           else
             {
-              throw makeException<ConfigureException>("MonitorPhy: Unexpected configuration item %s",
-                                                      item.first.c_str());
+              publishMode_ = PublishMode::SINGLE;
             }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sPublishMode.c_str());
         }
-    }
+      else if(item.first == "spectrumquery.frequencyblocksize")
+        {
+          u64FrequencyBlockSizeHz_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju Hz",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64FrequencyBlockSizeHz_);
+        }
+      else if(item.first == "spectrumquery.compression")
+        {
+          // regex has already validated values
+          bCompressionEnable_ = item.second[0].asString() == "zstd";
+
+          if(bCompressionEnable_ && !SpectrumEnergyCompressor::isAvailable())
+            {
+              throw makeException<ConfigureException>("MonitorPhy: %s zstd not available, built"
+                                                      " without libzstd",
+                                                      item.first.c_str());
+            }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  item.second[0].asString().c_str());
+        }
+      else if(item.first == "spectrumquery.compression.level")
+        {
+          iCompressionLevel_ = item.second[0].asINT32();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %d",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  iCompressionLevel_);
+        }
+      else if(item.first == "spectrumquery.compression.dictionary")
+        {
+          sCompressionDictionaryFile_ = item.second[0].asString();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sCompressionDictionaryFile_.c_str());
+        }
+      else if(item.first == "spectrumquery.metadata.enable")
+        {
+          bMetadataEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bMetadataEnable_ ? "on" : "off");
+        }
+      else if(item.first == "spectrumquery.metadata.refreshinterval")
+        {
+          metadataRefreshInterval_ = Microseconds{item.second[0].asUINT64()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju usec",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  metadataRefreshInterval_.count());
+        }
+      else if(item.first == "spectrumquery.shmring.name")
+        {
+          sSpectrumEnergyRingName_ = item.second[0].asString();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  sSpectrumEnergyRingName_.c_str());
+        }
+      else if(item.first == "spectrumquery.shmring.size")
+        {
+          u64SpectrumEnergyRingSize_ = item.second[0].asUINT64();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju bytes",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64SpectrumEnergyRingSize_);
+        }
+      else if(item.first == "spectrumquery.lastvaluecache.endpoint")
+        {
+          lastValueCacheAddr_ = item.second[0].asINETAddr();
+
+          bLastValueCacheEnable_ = true;
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  lastValueCacheAddr_.str().c_str());
+        }
+      else if(item.first == "loadgovernor.enable")
+        {
+          bLoadGovernorEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bLoadGovernorEnable_ ? "on" : "off");
+        }
+      else if(item.first == "loadgovernor.maxlevel")
+        {
+          u16LoadGovernorMaxLevel = item.second[0].asUINT16();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %hu",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u16LoadGovernorMaxLevel);
+        }
+      else if(item.first == "loadgovernor.highwatermark")
+        {
+          dLoadGovernorHighWatermark = item.second[0].asDouble();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %lf",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  dLoadGovernorHighWatermark);
+        }
+      else if(item.first == "loadgovernor.lowwatermark")
+        {
+          dLoadGovernorLowWatermark = item.second[0].asDouble();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %lf",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  dLoadGovernorLowWatermark);
+        }
+      else if(item.first == "loadgovernor.recoverycycles")
+        {
+          u16LoadGovernorRecoveryCycles = item.second[0].asUINT16();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %hu",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u16LoadGovernorRecoveryCycles);
+        }
+      else if(item.first == "spectrumquery.streaming.enable")
+        {
+          bStreamingEnable = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bStreamingEnable ? "on" : "off");
+        }
+      else if(item.first == "spectrumquery.streaming.watermark")
+        {
+          streamingWatermark = Microseconds{item.second[0].asUINT64()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %ju usec",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  streamingWatermark.count());
+        }
+      else if(item.first == "spectrumquery.streaming.revisionbins")
+        {
+          u16StreamingRevisionBins = item.second[0].asUINT16();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s = %hu",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u16StreamingRevisionBins);
+        }
+      else if(item.first == "threadschedule.nem" ||
+              item.first == "threadschedule.zmq")
+        {
+          ThreadSchedule schedule{};
+
+          try
+            {
+              schedule = parseThreadSchedule(item.second[0].asString());
+            }
+          catch(std::exception & exp)
+            {
+              throw makeException<ConfigureException>("MonitorPhy: %s %s",
+                                                      item.first.c_str(),
+                                                      exp.what());
+            }
+
+          (item.first == "threadschedule.nem" ? nemThreadSchedule_ : zmqThreadSchedule_) = schedule;
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  formatThreadSchedule(schedule).c_str());
+        }
+      else if(item.first == "stats.receivepowertableenable")
+        {
+          bStatsReceivePowerTableEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bStatsReceivePowerTableEnable_ ? "on" : "off");
+        }
+      else if(item.first == "stats.latencyhistogram.enable")
+        {
+          bLatencyHistogramEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bLatencyHistogramEnable_ ? "on" : "off");
+        }
+      else if(item.first == "stats.memory.refreshinterval")
+        {
+          memoryRefreshInterval_ = Microseconds{item.second[0].asUINT64()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %ju usec",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  memoryRefreshInterval_.count());
+        }
+      else if(item.first == "stats.eventtable.refreshinterval")
+        {
+          eventTableRefreshInterval_ = Microseconds{item.second[0].asUINT64()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %ju usec",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  eventTableRefreshInterval_.count());
+        }
+      else if(item.first == "stats.eventtable.maxrowsperrefresh")
+        {
+          std::uint64_t u64MaxRowsPerRefresh{item.second[0].asUINT64()};
+
+          eventTableStager_.setMaxRowsPerRefresh(u64MaxRowsPerRefresh);
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u64MaxRowsPerRefresh);
+        }
+      else
+        {
+          if(!item.first.compare(0,FADINGMANAGER_PREFIX.size(),FADINGMANAGER_PREFIX))
+            {
+              // event selected fading may use nakagami
+              if(item.first == FADINGMANAGER_PREFIX + "model")
+                {
+                  bNakagamiFading = item.second[0].asString() != "none";
+                }
+
+              fadingManagerConfiguration.push_back(item);
+            }
+          else
+            {
+              throw makeException<ConfigureException>("MonitorPhy: Unexpected configuration item %s",
+                                                      item.first.c_str());
+            }
+        }
+    }
 
   fadingManager_.configure(fadingManagerConfiguration);
 
-  if((maxSegmentOffset_ + maxMessagePropagation_ + 2 * maxSegmentDuration_) % noiseBinSize_ !=
-     Microseconds::zero())
+  if(bNakagamiFading && u64NakagamiVariatePoolSize_)
+    {
+      pNakagamiVariatePool_.reset(new NakagamiVariatePool{u64NakagamiVariatePoolSize_});
+
+      configureNakagamiVariatePool(fadingManagerConfiguration);
+
+      pNakagamiVariatePool_->refill();
+    }
+
+  gainGridManager_.configure(dAntennaGainGridResolutionDegrees,
+                             u64AntennaGainGridAccuracySampleRate);
+
+  // select the receive processor specialized for the configured
+  // propagation model and fading model
+  receiveProcessorAltFactory_ =
+    ReceiveProcessorAlt::selectFactory(pPropagationModelAlgorithm_.get(),
+                                       bNakagamiFading);
+
+  queryPeriod_ = spectrumQueryRate_;
+
+  if(bStreamingEnable)
+    {
+      // revision bins are queried along with each streamed bin
+      if(spectrumQueryBinSize_ * (u16StreamingRevisionBins + 1) > maxSegmentDuration_)
+        {
+          throw makeException<ConfigureException>("MonitorPhy: spectrumquery.binsize * (spectrumquery.streaming.revisionbins"
+                                                  " + 1) greater than noisemaxsegmentduration");
+        }
+
+      queryPeriod_ = spectrumQueryBinSize_;
+
+      queryWatermark_ = streamingWatermark;
+
+      streamingBinTracker_.configure(spectrumQueryBinSize_,u16StreamingRevisionBins);
+    }
+
+  if(bLoadGovernorEnable_)
+    {
+      if(dLoadGovernorLowWatermark >= dLoadGovernorHighWatermark)
+        {
+          throw makeException<ConfigureException>("MonitorPhy: loadgovernor.lowwatermark %lf must be less"
+                                                  " than loadgovernor.highwatermark %lf",
+                                                  dLoadGovernorLowWatermark,
+                                                  dLoadGovernorHighWatermark);
+        }
+
+      // degraded bin sizes must still evenly divide the query rate
+      std::uint16_t u16MaxLevel{};
+
+      while(u16MaxLevel < u16LoadGovernorMaxLevel &&
+            queryPeriod_ % (spectrumQueryBinSize_ * (std::uint64_t{2} << u16MaxLevel)) == Microseconds::zero())
+        {
+          ++u16MaxLevel;
+        }
+
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              INFO_LEVEL,
+                              "PHYI %03hu MonitorPhy::%s: load governor max level %hu",
+                              id_,
+                              __func__,
+                              u16MaxLevel);
+
+      loadGovernor_.configure(u16MaxLevel,
+                              dLoadGovernorHighWatermark,
+                              dLoadGovernorLowWatermark,
+                              u16LoadGovernorRecoveryCycles);
+    }
+
+  if((maxSegmentOffset_ + maxMessagePropagation_ + 2 * maxSegmentDuration_) % noiseBinSize_ !=
+     Microseconds::zero())
+    {
+      throw makeException<ConfigureException>("noisemaxsegmentoffset + noisemaxmessagepropagation"
+                                              " + 2 * noisemaxsegmentduration not evenly divisible by the"
+                                              " noisebinsize");
+    }
+
+  pSpectrumService_->initialize(0, //subid
+                                NoiseMode::OUTOFBAND,
+                                noiseBinSize_,
+                                maxSegmentOffset_,
+                                maxMessagePropagation_,
+                                maxSegmentDuration_,
+                                timeSyncThreshold_,
+                                bNoiseMaxClamp_,
+                                false);
+
+  if(bCompressionEnable_)
+    {
+      sSpectrumEnergyTopic_ = SPECTRUM_ENERGY_TOPIC + "." + COMPRESSED_TOPIC_SUFFIX;
+
+      sSpectrumMetadataTopic_ = SPECTRUM_METADATA_TOPIC + "." + COMPRESSED_TOPIC_SUFFIX;
+    }
+
+  if(u64RetentionTierSize_)
+    {
+      if(!bSpectrumHistoryEnable_)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: spectrumquery.retention.tiersize set without"
+                                  " spectrumquery.history.endpoint, retained energy cannot be queried",
+                                  id_,
+                                  __func__);
+        }
+
+      spectrumEnergyHistory_.configure(u16RetentionTiers_,
+                                       u64RetentionTierSize_,
+                                       queryPeriod_,
+                                       queryPeriod_ / spectrumQueryBinSize_);
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::start()
+{
+  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                          DEBUG_LEVEL,
+                          "PHYI %03hu MonitorPhy::%s",
+                          id_,
+                          __func__);
+
+  // add default antenna
+  Antenna rxAntenna = optionalFixedAntennaGaindBi_.second ?
+    Antenna::createIdealOmni(DEFAULT_ANTENNA_INDEX,
+                             optionalFixedAntennaGaindBi_.first) :
+    Antenna::createProfileDefined(DEFAULT_ANTENNA_INDEX);
+
+  antennaManager_.update(id_,rxAntenna);
+
+  pZMQContext_ = zmq_ctx_new();
+
+  if(!pZMQContext_)
+    {
+      throw makeException<StartException>("unable to create zmq context");
+    }
+
+  // zmq I/O threads are created with the first socket
+  if(!zmqThreadSchedule_.cpus_.empty())
+    {
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+      for(const auto & iCPU : zmqThreadSchedule_.cpus_)
+        {
+          if(zmq_ctx_set(pZMQContext_,ZMQ_THREAD_AFFINITY_CPU_ADD,iCPU) < 0)
+            {
+              throw makeException<StartException>("unable to set zmq thread affinity: %s",
+                                                  zmq_strerror(errno));
+            }
+        }
+#else
+      throw makeException<StartException>("zmq thread affinity not supported by libzmq %d.%d.%d",
+                                          ZMQ_VERSION_MAJOR,
+                                          ZMQ_VERSION_MINOR,
+                                          ZMQ_VERSION_PATCH);
+#endif
+    }
+
+  if(zmqThreadSchedule_.iPolicy_ != -1)
+    {
+      if(zmq_ctx_set(pZMQContext_,ZMQ_THREAD_SCHED_POLICY,zmqThreadSchedule_.iPolicy_) < 0 ||
+         (zmqThreadSchedule_.iPriority_ &&
+          zmq_ctx_set(pZMQContext_,ZMQ_THREAD_PRIORITY,zmqThreadSchedule_.iPriority_) < 0))
+        {
+          throw makeException<StartException>("unable to set zmq thread scheduling: %s",
+                                              zmq_strerror(errno));
+        }
+    }
+
+
+  // XPUB passes subscriptions up so queries can skip what no one
+  // is listening to
+  pZMQSocket_ = zmq_socket(pZMQContext_,ZMQ_XPUB);
+
+  if(!pZMQSocket_)
+    {
+      throw makeException<StartException>("unable to create zmq pubsub socket");
+    }
+
+  std::string sPublishEndpoint{"tcp://"};
+
+  sPublishEndpoint += spectrumQueryPublishAddr_.str();
+
+  if(zmq_bind(pZMQSocket_,sPublishEndpoint.c_str()) < 0)
+    {
+      throw makeException<StartException>("Error binding publish socket: %s",
+                                          zmq_strerror(errno));
+    }
+
+  if(bSpectrumHistoryEnable_)
+    {
+      pZMQHistorySocket_ = zmq_socket(pZMQContext_,ZMQ_REP);
+
+      if(!pZMQHistorySocket_)
+        {
+          throw makeException<StartException>("unable to create zmq history socket");
+        }
+
+      std::string sHistoryEndpoint{"tcp://"};
+
+      sHistoryEndpoint += spectrumHistoryAddr_.str();
+
+      if(zmq_bind(pZMQHistorySocket_,sHistoryEndpoint.c_str()) < 0)
+        {
+          throw makeException<StartException>("Error binding history socket: %s",
+                                              zmq_strerror(errno));
+        }
+    }
+
+  // snapshots are answered on their own thread and socket, only the
+  // requesting subscriber receives them
+  if(bLastValueCacheEnable_)
+    {
+      try
+        {
+          lastValueCacheServer_.start(pZMQContext_,
+                                      "tcp://" + lastValueCacheAddr_.str(),
+                                      sSpectrumMetadataTopic_,
+                                      zmqThreadSchedule_);
+        }
+      catch(std::exception & exp)
+        {
+          throw makeException<StartException>("Unable to start last value cache: %s",
+                                              exp.what());
+        }
+    }
+
+
+  if(!sSpectrumQueryRecorderFile_.empty())
+    {
+      recorderFileStream_.open(sSpectrumQueryRecorderFile_,
+                               std::fstream::out | std::fstream::trunc);
+
+      if(!recorderFileStream_)
+        {
+          throw makeException<StartException>("Unable to open: %s",
+                                              sSpectrumQueryRecorderFile_.c_str());
+        }
+    }
+
+  if(!sSpectrumEnergyRingName_.empty())
+    {
+      try
+        {
+          spectrumEnergyRingWriter_.open(sSpectrumEnergyRingName_,
+                                         u64SpectrumEnergyRingSize_);
+        }
+      catch(std::system_error & exp)
+        {
+          throw makeException<StartException>("Unable to create spectrum energy ring: %s",
+                                              exp.what());
+        }
+    }
+
+  if(bCompressionEnable_)
+    {
+      std::vector<std::uint8_t> dictionary{};
+
+      if(!sCompressionDictionaryFile_.empty())
+        {
+          std::ifstream dictionaryStream{sCompressionDictionaryFile_,
+                                         std::ifstream::in | std::ifstream::binary};
+
+          if(!dictionaryStream)
+            {
+              throw makeException<StartException>("Unable to open: %s",
+                                                  sCompressionDictionaryFile_.c_str());
+            }
+
+          dictionary.assign(std::istreambuf_iterator<char>{dictionaryStream},
+                            std::istreambuf_iterator<char>{});
+        }
+
+      try
+        {
+          spectrumEnergyCompressor_.start(iCompressionLevel_,
+                                          dictionary,
+                                          COMPRESSION_QUEUE_DEPTH,
+                                          std::bind(&MonitorPhy::sendSpectrumEnergy,
+                                                    this,
+                                                    std::placeholders::_1,
+                                                    std::placeholders::_2,
+                                                    std::placeholders::_3,
+                                                    std::placeholders::_4),
+                                          zmqThreadSchedule_);
+        }
+      catch(std::exception & exp)
+        {
+          throw makeException<StartException>("Unable to start spectrum energy compression: %s",
+                                              exp.what());
+        }
+    }
+
+  querySpectrumService();
+
+  pPlatformService_->timerService().
+    schedule(std::bind(&MonitorPhy::processSubscriptions,
+                       this),
+             Clock::now() + SUBSCRIPTION_INTERVAL,
+             SUBSCRIPTION_INTERVAL);
+
+  // timed events run on the NEM processing thread
+  if(!nemThreadSchedule_.cpus_.empty() || nemThreadSchedule_.iPolicy_ != -1)
+    {
+      pPlatformService_->timerService().
+        schedule(std::bind(&MonitorPhy::applyNEMThreadSchedule,
+                           this),
+                 Clock::now());
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::applyNEMThreadSchedule()
+{
+  if(int iError = applyThreadSchedule(nemThreadSchedule_))
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "PHYI %03hu MonitorPhy::%s unable to apply NEM thread schedule %s: %s",
+                              id_,
+                              __func__,
+                              formatThreadSchedule(nemThreadSchedule_).c_str(),
+                              strerror(iError));
+    }
+  else
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              INFO_LEVEL,
+                              "PHYI %03hu MonitorPhy::%s NEM thread schedule %s",
+                              id_,
+                              __func__,
+                              formatThreadSchedule(nemThreadSchedule_).c_str());
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::stop()
+{
+  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                          DEBUG_LEVEL,
+                          "PHYI %03hu MonitorPhy::%s",
+                          id_,
+                          __func__);
+
+  // joins the compression thread, queued messages are discarded
+  spectrumEnergyCompressor_.stop();
+
+  lastValueCacheServer_.stop();
+}
+
+void EMANE::SpectrumTools::MonitorPhy::destroy() throw()
+{
+  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                          DEBUG_LEVEL,
+                          "PHYI %03hu MonitorPhy::%s",
+                          id_,
+                          __func__);
+
+}
+
+void EMANE::SpectrumTools::MonitorPhy::processConfiguration(const ConfigurationUpdate & update)
+{
+  ConfigurationUpdate fadingManagerConfiguration{};
+
+  for(const auto & item : update)
+    {
+      if(item.first == "fixedantennagain")
+        {
+          optionalFixedAntennaGaindBi_.first = item.second[0].asDouble();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s: %s = %3.2f dBi",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  optionalFixedAntennaGaindBi_.first);
+
+        }
+      else
+        {
+          if(!item.first.compare(0,FADINGMANAGER_PREFIX.size(),FADINGMANAGER_PREFIX))
+            {
+              fadingManagerConfiguration.push_back(item);
+            }
+        }
+    }
+
+  fadingManager_.modify(fadingManagerConfiguration);
+
+  if(pNakagamiVariatePool_)
+    {
+      configureNakagamiVariatePool(fadingManagerConfiguration);
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::configureNakagamiVariatePool(const ConfigurationUpdate & update)
+{
+  const std::string sNakagamiPrefix{FADINGMANAGER_PREFIX + "nakagami."};
+
+  for(const auto & item : update)
+    {
+      if(item.first == sNakagamiPrefix + "m0")
+        {
+          pNakagamiVariatePool_->setM(0,item.second[0].asDouble());
+        }
+      else if(item.first == sNakagamiPrefix + "m1")
+        {
+          pNakagamiVariatePool_->setM(1,item.second[0].asDouble());
+        }
+      else if(item.first == sNakagamiPrefix + "m2")
+        {
+          pNakagamiVariatePool_->setM(2,item.second[0].asDouble());
+        }
+      else if(item.first == sNakagamiPrefix + "distance0")
+        {
+          pNakagamiVariatePool_->setDistance0Meters(item.second[0].asDouble());
+        }
+      else if(item.first == sNakagamiPrefix + "distance1")
+        {
+          pNakagamiVariatePool_->setDistance1Meters(item.second[0].asDouble());
+        }
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::processDownstreamControl(const ControlMessages &)
+{}
+
+void EMANE::SpectrumTools::MonitorPhy::processDownstreamPacket(DownstreamPacket &,
+                                                               const ControlMessages &)
+{}
+
+
+void EMANE::SpectrumTools::MonitorPhy::processUpstreamPacket(const CommonPHYHeader & commonPhyHeader,
+                                                             UpstreamPacket & pkt,
+                                                             const ControlMessages &)
+{
+  auto now = Clock::now();
+
+  LatencyHistogramTable::StageTimer stageTimer{bLatencyHistogramEnable_ ? &latencyHistogramTable_ : nullptr};
+
+  processUpstreamPacket_i(now,commonPhyHeader,pkt,{});
+
+  stageTimer.mark(LatencyHistogramTable::STAGE_UPSTREAM_PACKET);
+
+  if(bLoadGovernorEnable_)
+    {
+      loadGovernor_.addProcessingTime(std::chrono::duration_cast<Microseconds>(Clock::now() - now));
+    }
+}
+
+void EMANE::SpectrumTools::MonitorPhy::processUpstreamPacket_i(const TimePoint & now,
+                                                               const CommonPHYHeader & commonPHYHeader,
+                                                               UpstreamPacket & pkt,
+                                                               const ControlMessages &)
+{
+  LOGGER_VERBOSE_LOGGING_FN_VARGS(pPlatformService_->logService(),
+                                  DEBUG_LEVEL,
+                                  std::bind(&CommonPHYHeader::format, std::ref(commonPHYHeader)),
+                                  "PHYI %03hu MonitorPhy::%s Common Phy Header",
+                                  id_,
+                                  __func__);
+
+  const  auto & pktInfo = pkt.getPacketInfo();
+
+  EMANE_SPECTRUM_TOOLS_PROBE5(packet_ingress,
+                              pktInfo.getSource(),
+                              pktInfo.getDestination(),
+                              commonPHYHeader.getSubId(),
+                              std::chrono::duration_cast<Microseconds>(commonPHYHeader.getTxTime().time_since_epoch()).count(),
+                              std::chrono::duration_cast<Microseconds>(now.time_since_epoch()).count());
+
+  commonLayerStatistics_.processInbound(pkt);
+
+  if(!commonPHYHeader.getTransmitAntennas().size())
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "PHYI %03hu MonitorPhy::%s "
+                              " src %hu, dst %hu, drop no tx antennas",
+                              id_,
+                              __func__,
+                              pktInfo.getSource(),
+                              pktInfo.getDestination());
+
+      EMANE_SPECTRUM_TOOLS_PROBE4(packet_drop,
+                                  pktInfo.getSource(),
+                                  pktInfo.getDestination(),
+                                  commonPHYHeader.getSubId(),
+                                  static_cast<int>(ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_NO_TX_ANTENNAS));
+
+      commonLayerStatistics_.processOutbound(pkt,
+                                             std::chrono::duration_cast<Microseconds>(Clock::now() - now),
+                                             DROP_CODE_MISSING_CONTROL);
+
+      // drop
+      return;
+    }
+
+  auto iter  = spectrumMap_.find(commonPHYHeader.getSubId());
+
+  if(iter == spectrumMap_.end())
+    {
+      auto pSpectrumMonitorAlt = new SpectrumMonitorAlt{commonPHYHeader.getSubId(),
+        noiseBinSize_,
+        maxSegmentOffset_,
+        maxMessagePropagation_,
+        maxSegmentDuration_,
+        timeSyncThreshold_,
+        bNoiseMaxClamp_,
+        noiseRecorderBackendType_,
+        noiseRecorderHugePageMode_};
+
+      iter =
+        spectrumMap_.insert(std::make_pair(commonPHYHeader.getSubId(),
+                                           std::make_tuple(commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() ?
+                                                           commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() :
+                                                           SpectralMaskManager::instance()->getPrimarySignalBandwidth(commonPHYHeader.getTransmitAntennas()[0].getSpectralMaskIndex()),
+                                                           std::unique_ptr<SpectrumMonitorAlt>(pSpectrumMonitorAlt),
+                                                           std::unique_ptr<ReceiveProcessorAlt>(receiveProcessorAltFactory_(id_,
+                                                                                                                            commonPHYHeader.getSubId(),
+                                                                                                                            DEFAULT_ANTENNA_INDEX,
+                                                                                                                            gainManager_,
+                                                                                                                            bAntennaGainGridEnable_ ? &gainGridManager_ : nullptr,
+                                                                                                                            pSpectrumMonitorAlt,
+                                                                                                                            pPropagationModelAlgorithm_.get(),
+                                                                                                                            fadingManager_.createFadingAlgorithmStore(),
+                                                                                                                            pNakagamiVariatePool_.get(),
+                                                                                                                            bLatencyHistogramEnable_ ? &latencyHistogramTable_ : nullptr,
+                                                                                                                            bStatsReceivePowerTableEnable_)))).first;
+
+    }
+  else
+    {
+      std::uint64_t u64BandwidthHz = commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() ?
+        commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() :
+        SpectralMaskManager::instance()->getPrimarySignalBandwidth(commonPHYHeader.getTransmitAntennas()[0].getSpectralMaskIndex());
+
+      if(std::get<0>(iter->second) != u64BandwidthHz)
+        {
+          std::get<0>(iter->second) = u64BandwidthHz;
+        }
+    }
+
+  LatencyHistogramTable::StageTimer stageTimer{bLatencyHistogramEnable_ ? &latencyHistogramTable_ : nullptr};
+
+  std::vector<std::pair<LocationInfo,bool>> locationInfos{};
+  std::vector<std::pair<FadingInfo,bool>> fadingSelections{};
+
+  for(const auto & transmitter : commonPHYHeader.getTransmitters())
+    {
+      locationInfos.push_back(locationManager_.getLocationInfo(transmitter.getNEMId()));
+
+      fadingSelections.push_back(fadingManager_.getFadingSelection(transmitter.getNEMId()));
+
+      for(const auto & txAntenna : commonPHYHeader.getTransmitAntennas())
+        {
+          antennaManager_.update(transmitter.getNEMId(),txAntenna);
+        }
+    }
+
+  stageTimer.mark(LatencyHistogramTable::STAGE_LOCATION_LOOKUP);
+
+  auto result = std::get<2>(iter->second)->process(now,
+                                                   commonPHYHeader,
+                                                   locationInfos,
+                                                   fadingSelections);
+
+  stageTimer.mark(LatencyHistogramTable::STAGE_RECEIVE_PROCESS);
+
+  if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_OFFSET)
+    {
+      statisticCounterShards_.increment(COUNTER_SPECTRUM_CLAMP_OFFSET);
+    }
+
+  if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_DURATION)
+    {
+      statisticCounterShards_.increment(COUNTER_SPECTRUM_CLAMP_DURATION);
+    }
+
+  if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_PROPAGATION)
+    {
+      statisticCounterShards_.increment(COUNTER_SPECTRUM_CLAMP_PROPAGATION);
+    }
+
+  if(result.status_ == ReceiveProcessorAlt::ProcessResult::Status::SUCCESS)
+    {
+      if(result.bGainCacheLookup_)
+        {
+          if(result.bGainCacheHit_)
+            {
+              statisticCounterShards_.increment(COUNTER_GAIN_CACHE_HIT);
+            }
+          else
+            {
+              statisticCounterShards_.increment(COUNTER_GAIN_CACHE_MISS);
+            }
+        }
+
+      for(const auto & entry : result.receivePowerMap_)
+        {
+          receivePowerTablePublisher_.update(std::get<0>(entry.first),
+                                             std::get<1>(entry.first),
+                                             std::get<2>(entry.first),
+                                             std::get<3>(entry.first),
+                                             std::get<0>(entry.second),
+                                             std::get<1>(entry.second),
+                                             std::get<2>(entry.second),
+                                             std::get<3>(entry.second),
+                                             std::get<4>(entry.second),
+                                             0,
+                                             commonPHYHeader.getTxTime());
+        }
+
+      EMANE_SPECTRUM_TOOLS_PROBE4(packet_egress,
+                                  pktInfo.getSource(),
+                                  pktInfo.getDestination(),
+                                  commonPHYHeader.getSubId(),
+                                  std::chrono::duration_cast<Microseconds>(Clock::now().time_since_epoch()).count());
+    }
+  else
+    {
+      EMANE_SPECTRUM_TOOLS_PROBE4(packet_drop,
+                                  pktInfo.getSource(),
+                                  pktInfo.getDestination(),
+                                  commonPHYHeader.getSubId(),
+                                  static_cast<int>(result.status_));
+
+      std::string sReason{"unknown"};
+      LogLevel logLevel{DEBUG_LEVEL};
+      bool bNoError{};
+
+      Microseconds processingDuration{std::chrono::duration_cast<Microseconds>(Clock::now() - now)};
+
+      switch(result.status_)
+        {
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_ANTENNA_FREQ_INDEX:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_ANTENNA_FREQ_INDEX);
+          sReason = "transmit antenna frequency index invalid";
+          logLevel = ERROR_LEVEL;
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_LOCATION:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_FADINGMANAGER_LOCATION);
+          sReason = "FadingManager missing location information";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_ALGORITHM:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_FADINGMANAGER_ALGORITHM);
+
+          sReason = "FadingManager unknown algorithm";
+          logLevel = ERROR_LEVEL;
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_SELECTION:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_FADINGMANAGER_SELECTION);
+
+          sReason = "FadingManager unknown fading selection for transmitter";
+
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_LOCATION:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_GAINMANAGER_LOCATION);
+
+          sReason = "GainManager missing location information";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNAPROFILE:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_GAINMANAGER_ANTENNAPROFILE);
+          sReason = "GainManager unknown antenna profile";
+          logLevel = ERROR_LEVEL;
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_HORIZON:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_GAINMANAGER_HORIZON);
+          sReason = "GainManager below horizon";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNA_INDEX:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_GAINMANAGER_ANTENNA_INDEX);
+          sReason = "GainManager unknown antenna index";
+          logLevel = ERROR_LEVEL;
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_PROPAGATIONMODEL:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_PROPAGATIONMODEL);
+          sReason = "propagation model missing information";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_SPECTRUM_CLAMP:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_SPECTRUM_CLAMP);
+          sReason = "SpectrumMonitor detected";
+
+          if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_OFFSET)
+            {
+              sReason += " segment offset";
+            }
+
+          if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_DURATION)
+            {
+              sReason += " segment duration";
+            }
+
+          if(result.u8SpectrumViolations_ & SpectrumMonitorAlt::UpdateResult::VIOLATION_PROPAGATION)
+            {
+              sReason += " propagation";
+            }
+
+          sReason += " range error";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_NOT_FOI:
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 processingDuration,
+                                                 DROP_CODE_NOT_FOI);
+          sReason = "message frequency not in frequency of interest list.";
+          break;
+
+        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_OUT_OF_BAND:
+          bNoError = true;
+          break;
+
+        default:
+          break;
+        }
+
+      if(!bNoError)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  logLevel,
+                                  "PHYI %03hu MonitorPhy::%s "
+                                  " src %hu, dst %hu, drop %s",
+                                  id_,
+                                  __func__,
+                                  pktInfo.getSource(),
+                                  pktInfo.getDestination(),
+                                  sReason.c_str());
+
+          // drop
+          return;
+        }
+    }
+}
+
+
+void EMANE::SpectrumTools::MonitorPhy::collectStatisticCounters()
+{
+  auto growth = statisticCounterShards_.collect();
+
+  *pGainCacheHit_ += growth[COUNTER_GAIN_CACHE_HIT];
+  *pGainCacheMiss_ += growth[COUNTER_GAIN_CACHE_MISS];
+  *pSpectrumClampOffset_ += growth[COUNTER_SPECTRUM_CLAMP_OFFSET];
+  *pSpectrumClampDuration_ += growth[COUNTER_SPECTRUM_CLAMP_DURATION];
+  *pSpectrumClampPropagation_ += growth[COUNTER_SPECTRUM_CLAMP_PROPAGATION];
+
+  if(bCompressionEnable_)
     {
-      throw makeException<ConfigureException>("noisemaxsegmentoffset + noisemaxmessagepropagation"
-                                              " + 2 * noisemaxsegmentduration not evenly divisible by the"
-                                              " noisebinsize");
+      // compressor counters are cumulative, add their growth so the
+      // clearable statistics can still be cleared
+      auto counters = spectrumEnergyCompressor_.getCounters();
+
+      *pCompressedMessages_ += counters.u64Messages_ - compressionCounters_.u64Messages_;
+      *pCompressionDrops_ += counters.u64Dropped_ - compressionCounters_.u64Dropped_;
+      *pCompressionCPUTime_ = counters.u64CPUTimeMicroseconds_;
+
+      if(counters.u64BytesOut_)
+        {
+          *pCompressionRatio_ =
+            static_cast<double>(counters.u64BytesIn_) / counters.u64BytesOut_;
+        }
+
+      compressionCounters_ = counters;
     }
 
-  pSpectrumService_->initialize(0, //subid
-                                NoiseMode::OUTOFBAND,
-                                noiseBinSize_,
-                                maxSegmentOffset_,
-                                maxMessagePropagation_,
-                                maxSegmentDuration_,
-                                timeSyncThreshold_,
-                                bNoiseMaxClamp_,
-                                false);
+  if(bLastValueCacheEnable_)
+    {
+      auto u64Messages = lastValueCacheServer_.getMessages();
+
+      *pLastValueCacheReplays_ += u64Messages - u64LastValueCacheMessages_;
 
+      u64LastValueCacheMessages_ = u64Messages;
+    }
+
+  if(spectrumEnergyHistory_.isEnabled())
+    {
+      *pRetainedHistoryDuration_ = spectrumEnergyHistory_.getRetainedDuration().count();
+    }
 }
 
-void EMANE::SpectrumTools::MonitorPhy::start()
+const std::string &
+EMANE::SpectrumTools::MonitorPhy::getSubIdTopic(std::uint16_t u16SubId)
 {
-  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                          DEBUG_LEVEL,
-                          "PHYI %03hu MonitorPhy::%s",
-                          id_,
-                          __func__);
+  auto iter = subIdTopics_.find(u16SubId);
 
-  // add default antenna
-  Antenna rxAntenna = optionalFixedAntennaGaindBi_.second ?
-    Antenna::createIdealOmni(DEFAULT_ANTENNA_INDEX,
-                             optionalFixedAntennaGaindBi_.first) :
-    Antenna::createProfileDefined(DEFAULT_ANTENNA_INDEX);
+  if(iter == subIdTopics_.end())
+    {
+      // trailing separator keeps prefix filtering on a sub id from
+      // matching other sub ids sharing the same leading digits
+      iter = subIdTopics_.emplace(u16SubId,
+                                  SPECTRUM_ENERGY_TOPIC + "." + std::to_string(u16SubId) + ".").first;
+    }
 
-  antennaManager_.update(id_,rxAntenna);
+  return iter->second;
+}
 
-  pZMQContext_ = zmq_ctx_new();
+const std::string &
+EMANE::SpectrumTools::MonitorPhy::getSpectrumEnergyTopic(std::uint16_t u16SubId,
+                                                         std::uint64_t u64BlockStartHz)
+{
+  auto iter = spectrumEnergyTopics_.find(TopicKey{u16SubId,u64BlockStartHz});
 
-  if(!pZMQContext_)
+  if(iter == spectrumEnergyTopics_.end())
     {
-      throw makeException<StartException>("unable to create zmq context");
+      std::string sTopic{getSubIdTopic(u16SubId)};
+
+      if(publishMode_ == PublishMode::FREQUENCY_BLOCK)
+        {
+          sTopic += std::to_string(u64BlockStartHz) + ".";
+        }
+
+      if(bCompressionEnable_)
+        {
+          sTopic += COMPRESSED_TOPIC_SUFFIX;
+        }
+
+      iter = spectrumEnergyTopics_.emplace(TopicKey{u16SubId,u64BlockStartHz},
+                                           std::move(sTopic)).first;
+    }
+
+  return iter->second;
+}
+
+void EMANE::SpectrumTools::MonitorPhy::processSubscriptions()
+{
+  std::uint8_t buf[256];
+
+  int iLength{};
+
+  std::lock_guard<std::mutex> m(zmqSocketMutex_);
+
+  // subscription messages are queued on the publish socket,
+  // prefixes longer than any published topic are ignored
+  while((iLength = zmq_recv(pZMQSocket_,buf,sizeof(buf),ZMQ_DONTWAIT)) >= 0)
+    {
+      if(static_cast<std::size_t>(iLength) > sizeof(buf))
+        {
+          continue;
+        }
+
+      if(subscriptionTracker_.process(buf,iLength))
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s %s '%.*s' subscriptions: %zu",
+                                  id_,
+                                  __func__,
+                                  buf[0] ? "subscribe" : "unsubscribe",
+                                  iLength - 1,
+                                  reinterpret_cast<const char *>(buf + 1),
+                                  subscriptionTracker_.size());
+        }
+    }
+
+  *pSpectrumSubscriptions_ = subscriptionTracker_.size();
+}
+
+void EMANE::SpectrumTools::MonitorPhy::processHistoryRequests()
+{
+  std::uint64_t u64CycleNoiseBins{};
+
+  for(std::size_t i = 0; i < HISTORY_REQUESTS_PER_CYCLE; ++i)
+    {
+      EMANESpectrumMonitor::SpectrumHistoryResponse response{};
+
+      // a request that did not fit in the previous cycle is answered
+      // before the next is received, a rep socket holds further
+      // requests until it replies
+      if(!pPendingHistoryRequest_)
+        {
+          zmq_msg_t requestMessage;
+
+          zmq_msg_init(&requestMessage);
+
+          // requests are queued by the zmq I/O threads, only the reply
+          // is computed on the NEM processing thread
+          if(zmq_msg_recv(&requestMessage,pZMQHistorySocket_,ZMQ_DONTWAIT) < 0)
+            {
+              zmq_msg_close(&requestMessage);
+              break;
+            }
+
+          pPendingHistoryRequest_.reset(new EMANESpectrumMonitor::SpectrumHistoryRequest{});
+
+          if(!pPendingHistoryRequest_->ParseFromArray(zmq_msg_data(&requestMessage),
+                                                      zmq_msg_size(&requestMessage)))
+            {
+              pPendingHistoryRequest_.reset();
+
+              auto pResult = response.add_results();
+
+              pResult->set_success(false);
+
+              pResult->set_error("unable to parse request");
+
+              ++*pSpectrumHistoryQueryErrors_;
+            }
+
+          zmq_msg_close(&requestMessage);
+        }
+
+      if(pPendingHistoryRequest_)
+        {
+          // charged before any reduction, a request over the limit on
+          // its own is refused when answered
+          std::uint64_t u64RequestNoiseBins{getHistoryRequestCost(*pPendingHistoryRequest_)};
+
+          if(u64RequestNoiseBins <= u64SpectrumHistoryMaxNoiseBins_)
+            {
+              if(u64CycleNoiseBins + u64RequestNoiseBins > u64SpectrumHistoryMaxNoiseBins_)
+                {
+                  break;
+                }
+
+              u64CycleNoiseBins += u64RequestNoiseBins;
+            }
+
+          answerHistoryRequest(*pPendingHistoryRequest_,&response);
+
+          pPendingHistoryRequest_.reset();
+        }
+
+      std::string sResponse{};
+
+      response.SerializeToString(&sResponse);
+
+      // a rep socket must reply before receiving the next request
+      if(zmq_send(pZMQHistorySocket_,sResponse.data(),sResponse.size(),0) < 0)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s zmq send error %s",
+                                  id_,
+                                  __func__,
+                                  zmq_strerror(errno));
+        }
+    }
+}
+
+std::uint64_t
+EMANE::SpectrumTools::MonitorPhy::getHistoryRequestCost(const EMANESpectrumMonitor::SpectrumHistoryRequest & request) const
+{
+  std::uint64_t u64NoiseBins{};
+
+  for(const auto & query : request.queries())
+    {
+      auto iter = spectrumMap_.find(query.subid());
+
+      // an unknown sub id is refused without a reduction
+      if(iter == spectrumMap_.end())
+        {
+          continue;
+        }
+
+      // a longer duration is refused without a reduction
+      Microseconds duration{std::min(Microseconds{query.duration()},maxSegmentDuration_)};
+
+      std::uint64_t u64Frequencies{query.has_frequency_hz() ?
+          1 : std::get<1>(iter->second)->getFrequencies().size()};
+
+      u64NoiseBins += (duration / noiseBinSize_ + 1) * u64Frequencies;
+    }
+
+  return u64NoiseBins;
+}
+
+void EMANE::SpectrumTools::MonitorPhy::answerHistoryRequest(const EMANESpectrumMonitor::SpectrumHistoryRequest & request,
+                                                            EMANESpectrumMonitor::SpectrumHistoryResponse * pResponse)
+{
+  // a request over any limit is refused whole, before any of its
+  // queries are answered
+  std::uint64_t u64RequestBins{};
+
+  for(const auto & query : request.queries())
+    {
+      if(query.bin_size())
+        {
+          u64RequestBins += query.duration() / query.bin_size();
+        }
+    }
+
+  std::string sError{};
+
+  if(static_cast<std::uint64_t>(request.queries_size() + request.retained_size()) >
+     u64SpectrumHistoryMaxQueries_)
+    {
+      sError = "query count greater than spectrumquery.history.maxqueries";
+    }
+  else if(u64RequestBins > u64SpectrumHistoryMaxBins_)
+    {
+      sError = "total bin count greater than spectrumquery.history.maxbins";
+    }
+  else if(getHistoryRequestCost(request) > u64SpectrumHistoryMaxNoiseBins_)
+    {
+      sError = "total noise bin count greater than spectrumquery.history.maxnoisebins";
+    }
+
+  if(!sError.empty())
+    {
+      auto pResult = pResponse->add_results();
+
+      pResult->set_success(false);
+
+      pResult->set_error(sError);
+
+      ++*pSpectrumHistoryQueryErrors_;
+
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              DEBUG_LEVEL,
+                              "PHYI %03hu SpectrumTools::MonitorPhy::%s: %s",
+                              id_,
+                              __func__,
+                              sError.c_str());
+
+      return;
+    }
+
+  for(const auto & query : request.queries())
+    {
+      auto pResult = pResponse->add_results();
+
+      ++*pSpectrumHistoryQueries_;
+
+      if(!answerHistoryQuery(query,pResult))
+        {
+          ++*pSpectrumHistoryQueryErrors_;
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  DEBUG_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s subid %u: %s",
+                                  id_,
+                                  __func__,
+                                  query.subid(),
+                                  pResult->error().c_str());
+        }
+    }
+
+  for(const auto & retained : request.retained())
+    {
+      auto pResult = pResponse->add_retained_results();
+
+      ++*pSpectrumHistoryQueries_;
+
+      if(!answerRetainedQuery(retained,pResult))
+        {
+          ++*pSpectrumHistoryQueryErrors_;
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  DEBUG_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s tier %u: %s",
+                                  id_,
+                                  __func__,
+                                  retained.tier(),
+                                  pResult->error().c_str());
+        }
+    }
+}
+
+bool EMANE::SpectrumTools::MonitorPhy::answerHistoryQuery(const EMANESpectrumMonitor::SpectrumHistoryRequest::Query & query,
+                                                          EMANESpectrumMonitor::SpectrumHistoryResponse::Result * pResult)
+{
+  auto iter = spectrumMap_.find(query.subid());
+
+  Microseconds binSize{query.bin_size()};
+
+  Microseconds duration{query.duration()};
+
+  TimePoint startTime{Microseconds{query.start_time()}};
+
+  // the noise recorder holds a window either side of now, energy
+  // outside of it was never recorded or has been overwritten
+  Microseconds retainedWindow{maxSegmentOffset_ + maxMessagePropagation_ + 2 * maxSegmentDuration_};
+
+  auto now = Clock::now();
+
+  std::string sError{};
+
+  if(iter == spectrumMap_.end())
+    {
+      sError = "unknown subid";
+    }
+  else if(!binSize.count() || binSize % noiseBinSize_ != Microseconds::zero())
+    {
+      sError = "bin_size not a non-zero multiple of the noisebinsize";
+    }
+  else if(!duration.count() || duration % binSize != Microseconds::zero())
+    {
+      sError = "duration not a non-zero multiple of bin_size";
+    }
+  else if(duration > maxSegmentDuration_)
+    {
+      sError = "duration greater than noisemaxsegmentduration";
+    }
+  else if(static_cast<std::uint64_t>(duration / binSize) > u64SpectrumHistoryMaxBins_)
+    {
+      sError = "bin count greater than spectrumquery.history.maxbins";
+    }
+  else if(startTime < now - retainedWindow || startTime + duration > now + retainedWindow)
+    {
+      sError = "start_time outside the retained noise window";
+    }
+
+  if(!sError.empty())
+    {
+      pResult->set_success(false);
+
+      pResult->set_error(sError);
+
+      return false;
     }
 
+  std::size_t binCount = duration / binSize;
+
+  auto pSpectrumMonitor = std::get<1>(iter->second).get();
+
+  auto pEntry = pResult->mutable_entry();
+
+  pEntry->set_subid(iter->first);
+
+  pEntry->set_bandwidth_hz(std::get<0>(iter->second));
+
+  try
+    {
+      if(query.statistic() == EMANESpectrumMonitor::SpectrumHistoryRequest::MAX &&
+         !query.has_frequency_hz())
+        {
+          // same reduction as the published stream, every frequency
+          // is reduced in one pass
+          for(const auto & summary : pSpectrumMonitor->maxSummary(startTime,
+                                                                  binSize,
+                                                                  binCount))
+            {
+              addEnergy(pEntry,summary);
+            }
+        }
+      else
+        {
+          // a single frequency, or the mean of each, is reduced from
+          // its own window
+          auto reduce = query.statistic() == EMANESpectrumMonitor::SpectrumHistoryRequest::MAX ?
+            &maxNoiseBin : &meanNoiseBin;
+
+          FrequencySet frequencies{};
+
+          if(query.has_frequency_hz())
+            {
+              frequencies.insert(query.frequency_hz());
+            }
+          else
+            {
+              frequencies = pSpectrumMonitor->getFrequencies();
+            }
+
+          std::pair<std::uint64_t,std::vector<double>> summary{};
 
-  pZMQSocket_ = zmq_socket(pZMQContext_,ZMQ_PUB);
+          for(const auto & u64FrequencyHz : frequencies)
+            {
+              auto window = pSpectrumMonitor->request(u64FrequencyHz,duration,startTime);
 
-  if(!pZMQSocket_)
-    {
-      throw makeException<StartException>("unable to create zmq pubsub socket");
-    }
+              summary.first = u64FrequencyHz;
 
-  std::string sPublishEndpoint{"tcp://"};
+              summary.second.clear();
 
-  sPublishEndpoint += spectrumQueryPublishAddr_.str();
+              for(std::size_t i = 0; i < binCount; ++i)
+                {
+                  summary.second.push_back(reduce(window,
+                                                  startTime + binSize * i,
+                                                  startTime + binSize * (i + 1) - Microseconds{1}));
+                }
 
-  if(zmq_bind(pZMQSocket_,sPublishEndpoint.c_str()) < 0)
-    {
-      throw makeException<StartException>("Error binding publish socket: %s",
-                                          zmq_strerror(errno));
+              addEnergy(pEntry,summary);
+            }
+        }
     }
+  catch(SpectrumServiceException & exp)
+    {
+      pResult->clear_entry();
 
+      pResult->set_success(false);
 
-  if(!sSpectrumQueryRecorderFile_.empty())
-    {
-      recorderFileStream_.open(sSpectrumQueryRecorderFile_,
-                               std::fstream::out | std::fstream::trunc);
+      pResult->set_error(exp.what());
 
-      if(!recorderFileStream_)
-        {
-          throw makeException<StartException>("Unable to open: %s",
-                                              sSpectrumQueryRecorderFile_.c_str());
-        }
+      return false;
     }
 
-  querySpectrumService();
+  pResult->set_success(true);
+
+  return true;
 }
 
-void EMANE::SpectrumTools::MonitorPhy::stop()
+bool EMANE::SpectrumTools::MonitorPhy::answerRetainedQuery(const EMANESpectrumMonitor::SpectrumHistoryRequest::Retained & retained,
+                                                           EMANESpectrumMonitor::SpectrumHistoryResponse::RetainedResult * pResult)
 {
-  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                          DEBUG_LEVEL,
-                          "PHYI %03hu MonitorPhy::%s",
-                          id_,
-                          __func__);
+  std::string sError{};
 
-}
+  if(!spectrumEnergyHistory_.isEnabled())
+    {
+      sError = "retention disabled";
+    }
+  else if(retained.tier() >= spectrumEnergyHistory_.getTierCount())
+    {
+      sError = "tier greater than spectrumquery.retention.tiers";
+    }
+  else if(retained.sequences().empty() && !retained.has_start_time())
+    {
+      sError = "neither sequences nor start_time present";
+    }
 
-void EMANE::SpectrumTools::MonitorPhy::destroy() throw()
-{
-  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                          DEBUG_LEVEL,
-                          "PHYI %03hu MonitorPhy::%s",
-                          id_,
-                          __func__);
+  if(!sError.empty())
+    {
+      pResult->set_success(false);
 
-}
+      pResult->set_error(sError);
 
-void EMANE::SpectrumTools::MonitorPhy::processConfiguration(const ConfigurationUpdate & update)
-{
-  ConfigurationUpdate fadingManagerConfiguration{};
+      return false;
+    }
 
-  for(const auto & item : update)
+  // retained messages are returned as serialized, a receiver parses
+  // them as it would a published message
+  auto addEnergies = [pResult](const std::uint8_t * pData, std::size_t length)
     {
-      if(item.first == "fixedantennagain")
+      if(static_cast<std::size_t>(pResult->energies_size()) == RETAINED_MESSAGES_PER_RESULT)
         {
-          optionalFixedAntennaGaindBi_.first = item.second[0].asDouble();
-
-          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                  INFO_LEVEL,
-                                  "PHYI %03hu MonitorPhy::%s: %s = %3.2f dBi",
-                                  id_,
-                                  __func__,
-                                  item.first.c_str(),
-                                  optionalFixedAntennaGaindBi_.first);
+          pResult->set_truncated(true);
 
+          return false;
         }
-      else
-        {
-          if(!item.first.compare(0,FADINGMANAGER_PREFIX.size(),FADINGMANAGER_PREFIX))
-            {
-              fadingManagerConfiguration.push_back(item);
-            }
-        }
-    }
 
-  fadingManager_.modify(fadingManagerConfiguration);
-}
+      pResult->add_energies(pData,length);
 
-void EMANE::SpectrumTools::MonitorPhy::processDownstreamControl(const ControlMessages &)
-{}
+      return true;
+    };
 
-void EMANE::SpectrumTools::MonitorPhy::processDownstreamPacket(DownstreamPacket &,
-                                                               const ControlMessages &)
-{}
+  if(!retained.sequences().empty())
+    {
+      std::vector<std::uint64_t> sequences{retained.sequences().begin(),
+                                           retained.sequences().end()};
 
+      std::sort(sequences.begin(),sequences.end());
 
-void EMANE::SpectrumTools::MonitorPhy::processUpstreamPacket(const CommonPHYHeader & commonPhyHeader,
-                                                             UpstreamPacket & pkt,
-                                                             const ControlMessages &)
-{
-  processUpstreamPacket_i(Clock::now(),commonPhyHeader,pkt,{});
-}
+      spectrumEnergyHistory_.forEachSequence(retained.tier(),sequences,addEnergies);
+    }
+  else
+    {
+      spectrumEnergyHistory_.forEachTime(retained.tier(),
+                                         retained.start_time(),
+                                         retained.has_end_time() ?
+                                         retained.end_time() :
+                                         std::numeric_limits<std::uint64_t>::max(),
+                                         addEnergies);
+    }
 
-void EMANE::SpectrumTools::MonitorPhy::processUpstreamPacket_i(const TimePoint & now,
-                                                               const CommonPHYHeader & commonPHYHeader,
-                                                               UpstreamPacket & pkt,
-                                                               const ControlMessages &)
-{
-  LOGGER_VERBOSE_LOGGING_FN_VARGS(pPlatformService_->logService(),
-                                  DEBUG_LEVEL,
-                                  std::bind(&CommonPHYHeader::format, std::ref(commonPHYHeader)),
-                                  "PHYI %03hu MonitorPhy::%s Common Phy Header",
-                                  id_,
-                                  __func__);
+  *pSpectrumHistoryGapFills_ += pResult->energies_size();
 
-  const  auto & pktInfo = pkt.getPacketInfo();
+  pResult->set_success(true);
 
-  commonLayerStatistics_.processInbound(pkt);
+  return true;
+}
 
-  if(!commonPHYHeader.getTransmitAntennas().size())
-    {
-      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                              ERROR_LEVEL,
-                              "PHYI %03hu MonitorPhy::%s "
-                              " src %hu, dst %hu, drop no tx antennas",
-                              id_,
-                              __func__,
-                              pktInfo.getSource(),
-                              pktInfo.getDestination());
+void EMANE::SpectrumTools::MonitorPhy::publishSpectrumEnergy(const std::string & sTopic,
+                                                             const EMANESpectrumMonitor::SpectrumEnergy & msg,
+                                                             LatencyHistogramTable::StageTimer & stageTimer,
+                                                             bool bLastValue)
+{
+  // serialize directly into a pooled buffer, handed to ZMQ
+  // without a copy and returned to the pool once sent
+  auto pBuffer = serializationBufferPool_.acquire(msg.ByteSizeLong());
 
+  msg.SerializeWithCachedSizesToArray(pBuffer->data_.data());
 
+  std::size_t serializationLength{pBuffer->data_.size()};
 
-      commonLayerStatistics_.processOutbound(pkt,
-                                             std::chrono::duration_cast<Microseconds>(Clock::now() - now),
-                                             DROP_CODE_MISSING_CONTROL);
+  stageTimer.mark(LatencyHistogramTable::STAGE_SERIALIZE);
 
-      // drop
-      return;
-    }
+  EMANE_SPECTRUM_TOOLS_PROBE2(query_end,
+                              msg.sequence(),
+                              serializationLength);
 
-  auto iter  = spectrumMap_.find(commonPHYHeader.getSubId());
+  publishSerialized(sTopic,msg.sequence(),pBuffer,false,bLastValue);
 
-  if(iter == spectrumMap_.end())
-    {
-      auto pSpectrumMonitorAlt = new SpectrumMonitorAlt{commonPHYHeader.getSubId(),
-        noiseBinSize_,
-        maxSegmentOffset_,
-        maxMessagePropagation_,
-        maxSegmentDuration_,
-        timeSyncThreshold_,
-        bNoiseMaxClamp_};
+  stageTimer.mark(LatencyHistogramTable::STAGE_SEND);
+}
 
-      iter =
-        spectrumMap_.insert(std::make_pair(commonPHYHeader.getSubId(),
-                                           std::make_tuple(commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() ?
-                                                           commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() :
-                                                           SpectralMaskManager::instance()->getPrimarySignalBandwidth(commonPHYHeader.getTransmitAntennas()[0].getSpectralMaskIndex()),
-                                                           std::unique_ptr<SpectrumMonitorAlt>(pSpectrumMonitorAlt),
-                                                           std::unique_ptr<ReceiveProcessorAlt>(new ReceiveProcessorAlt{id_,
-                                                                                                                        0,
-                                                                                                                        DEFAULT_ANTENNA_INDEX,
-                                                                                                                        antennaManager_,
-                                                                                                                        pSpectrumMonitorAlt,
-                                                                                                                        pPropagationModelAlgorithm_.get(),
-                                                                                                                        fadingManager_.createFadingAlgorithmStore(),
-                                                                                                                        bStatsReceivePowerTableEnable_})))).first;
+void EMANE::SpectrumTools::MonitorPhy::publishSpectrumMetadata(const EMANESpectrumMonitor::SpectrumMetadata & msg)
+{
+  auto pBuffer = serializationBufferPool_.acquire(msg.ByteSizeLong());
 
-    }
-  else
-    {
-      std::uint64_t u64BandwidthHz = commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() ?
-        commonPHYHeader.getTransmitAntennas()[0].getBandwidthHz() :
-        SpectralMaskManager::instance()->getPrimarySignalBandwidth(commonPHYHeader.getTransmitAntennas()[0].getSpectralMaskIndex());
+  msg.SerializeWithCachedSizesToArray(pBuffer->data_.data());
 
-      if(std::get<0>(iter->second) != u64BandwidthHz)
-        {
-          std::get<0>(iter->second) = u64BandwidthHz;
-        }
-    }
+  publishSerialized(sSpectrumMetadataTopic_,msg.sequence(),pBuffer,true,true);
+}
 
-  std::vector<std::pair<LocationInfo,bool>> locationInfos{};
-  std::vector<std::pair<FadingInfo,bool>> fadingSelections{};
+void EMANE::SpectrumTools::MonitorPhy::publishSerialized(const std::string & sTopic,
+                                                         std::uint64_t u64Sequence,
+                                                         SerializationBufferPool::Buffer * pBuffer,
+                                                         bool bMetadata,
+                                                         bool bLastValue)
+{
+  std::size_t serializationLength{pBuffer->data_.size()};
 
-  for(const auto & transmitter : commonPHYHeader.getTransmitters())
+  // record before ownership of the buffer passes on
+  if(recorderFileStream_.is_open())
     {
-      locationInfos.push_back(locationManager_.getLocationInfo(transmitter.getNEMId()));
+      std::uint32_t u32MessageFrameLength =
+        htonl(static_cast<std::uint32_t>(serializationLength) | (bMetadata ? METADATA_FRAME_FLAG : 0));
 
-      fadingSelections.push_back(fadingManager_.getFadingSelection(transmitter.getNEMId()));
+      recorderFileStream_.write(reinterpret_cast<char *>(&u32MessageFrameLength),
+                                sizeof(u32MessageFrameLength));
 
-      for(const auto & txAntenna : commonPHYHeader.getTransmitAntennas())
-        {
-          antennaManager_.update(transmitter.getNEMId(),txAntenna);
-        }
-    }
+      recorderFileStream_.write(reinterpret_cast<const char *>(pBuffer->data_.data()),
+                                serializationLength);
 
-  auto result = std::get<2>(iter->second)->process(now,
-                                                   commonPHYHeader,
-                                                   locationInfos,
-                                                   fadingSelections);
+      EMANE_SPECTRUM_TOOLS_PROBE2(recorder_write,
+                                  u64Sequence,
+                                  serializationLength);
+    }
 
-  if(result.status_ == ReceiveProcessorAlt::ProcessResult::Status::SUCCESS)
+  if(spectrumEnergyRingWriter_.isOpen() &&
+     !spectrumEnergyRingWriter_.write(pBuffer->data_.data(),
+                                      serializationLength,
+                                      bMetadata ? SpectrumEnergyRing::RECORD_FLAG_METADATA : 0))
     {
-      if(result.bGainCacheHit_)
-        {
-          ++*pGainCacheHit_;
-        }
-      else
-        {
-          ++*pGainCacheMiss_;
-        }
+      ++*pSpectrumEnergyRingOversize_;
+    }
 
-      for(const auto & entry : result.receivePowerMap_)
+  // metadata takes the same path as energy so that it is never
+  // received after the energy referencing it
+  if(bCompressionEnable_)
+    {
+      if(!spectrumEnergyCompressor_.enqueue(&sTopic,u64Sequence,bLastValue,pBuffer))
         {
-          receivePowerTablePublisher_.update(std::get<0>(entry.first),
-                                             std::get<1>(entry.first),
-                                             std::get<2>(entry.first),
-                                             std::get<3>(entry.first),
-                                             std::get<0>(entry.second),
-                                             std::get<1>(entry.second),
-                                             std::get<2>(entry.second),
-                                             std::get<3>(entry.second),
-                                             std::get<4>(entry.second),
-                                             0,
-                                             commonPHYHeader.getTxTime());
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "PHYI %03hu SpectrumTools::MonitorPhy::%s compression queue full,"
+                                  " dropped sequence %ju",
+                                  id_,
+                                  __func__,
+                                  u64Sequence);
         }
     }
   else
     {
-      std::string sReason{"unknown"};
-      LogLevel logLevel{DEBUG_LEVEL};
-      bool bNoError{};
+      sendSpectrumEnergy(sTopic,u64Sequence,bLastValue,pBuffer);
+    }
+}
 
-      Microseconds processingDuration{std::chrono::duration_cast<Microseconds>(Clock::now() - now)};
+void EMANE::SpectrumTools::MonitorPhy::sendSpectrumEnergy(const std::string & sTopic,
+                                                          std::uint64_t u64Sequence,
+                                                          bool bLastValue,
+                                                          SerializationBufferPool::Buffer * pBuffer)
+{
+  std::size_t length{pBuffer->data_.size()};
 
-      switch(result.status_)
-        {
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_ANTENNA_FREQ_INDEX:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_ANTENNA_FREQ_INDEX);
-          sReason = "transmit antenna frequency index invalid";
-          logLevel = ERROR_LEVEL;
-          break;
+  zmq_msg_t energyMessage;
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_LOCATION:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_FADINGMANAGER_LOCATION);
-          sReason = "FadingManager missing location information";
-          break;
+  zmq_msg_init_data(&energyMessage,
+                    pBuffer->data_.data(),
+                    length,
+                    &SerializationBufferPool::release,
+                    pBuffer);
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_ALGORITHM:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_FADINGMANAGER_ALGORITHM);
+  // called from the NEM and compression threads
+  std::lock_guard<std::mutex> m(zmqSocketMutex_);
 
-          sReason = "FadingManager unknown algorithm";
-          logLevel = ERROR_LEVEL;
-          break;
+  // a revision repeats earlier bins and would leave a late joiner
+  // without the latest bin, only the latest bin is cached
+  if(bLastValueCacheEnable_ && bLastValue)
+    {
+      lastValueCacheServer_.update(sTopic,pBuffer->data_.data(),length);
+    }
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_FADINGMANAGER_SELECTION:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_FADINGMANAGER_SELECTION);
+  // topics are short and copied, the energy frame is not
+  bool bSent{zmq_send(pZMQSocket_,sTopic.c_str(),sTopic.size(),ZMQ_SNDMORE) >= 0 &&
+             zmq_msg_send(&energyMessage,pZMQSocket_,0) >= 0};
 
-          sReason = "FadingManager unknown fading selection for transmitter";
+  EMANE_SPECTRUM_TOOLS_PROBE3(zmq_send,
+                              u64Sequence,
+                              length,
+                              bSent);
 
-          break;
+  if(!bSent)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "PHYI %03hu SpectrumTools::MonitorPhy::%s zmq send error %s",
+                              id_,
+                              __func__,
+                              zmq_strerror(errno));
+    }
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_LOCATION:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_GAINMANAGER_LOCATION);
+  // an unsent buffer is released to the pool here
+  zmq_msg_close(&energyMessage);
+}
 
-          sReason = "GainManager missing location information";
-          break;
+void EMANE::SpectrumTools::MonitorPhy::reportMemory(const TimePoint & now)
+{
+  std::size_t frequencyCount{};
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNAPROFILE:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_GAINMANAGER_ANTENNAPROFILE);
-          sReason = "GainManager unknown antenna profile";
-          logLevel = ERROR_LEVEL;
-          break;
+  for(const auto & entry : spectrumMap_)
+    {
+      frequencyCount += std::get<1>(entry.second)->getFrequencies().size();
+    }
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_HORIZON:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_GAINMANAGER_HORIZON);
-          sReason = "GainManager below horizon";
-          break;
+  // sub ids and frequencies are added as they are first received,
+  // log whenever the set grows
+  bool bLog{frequencyCount != memoryReportFrequencyCount_};
+
+  bool bPublish{memoryRefreshInterval_.count() &&
+      now - lastMemoryRefreshTime_ >= memoryRefreshInterval_};
+
+  if(!bLog && !bPublish)
+    {
+      return;
+    }
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNA_INDEX:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_GAINMANAGER_ANTENNA_INDEX);
-          sReason = "GainManager unknown antenna index";
-          logLevel = ERROR_LEVEL;
-          break;
+  memoryReportFrequencyCount_ = frequencyCount;
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_PROPAGATIONMODEL:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_PROPAGATIONMODEL);
-          sReason = "propagation model missing information";
-          break;
+  std::size_t totalBytes{};
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_SPECTRUM_CLAMP:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_SPECTRUM_CLAMP);
-          sReason = "SpectrumManager detected request range error";
-          break;
+  for(const auto & entry : spectrumMap_)
+    {
+      auto pSpectrumMonitorAlt = std::get<1>(entry.second).get();
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_NOT_FOI:
-          commonLayerStatistics_.processOutbound(pkt,
-                                                 processingDuration,
-                                                 DROP_CODE_NOT_FOI);
-          sReason = "message frequency not in frequency of interest list.";
-          break;
+      std::size_t subIdBytes{};
 
-        case ReceiveProcessorAlt::ProcessResult::Status::DROP_CODE_OUT_OF_BAND:
-          bNoError = true;
-          break;
+      for(const auto & u64FrequencyHz : pSpectrumMonitorAlt->getFrequencies())
+        {
+          std::size_t bytes{pSpectrumMonitorAlt->getCommittedBytes(u64FrequencyHz)};
 
-        default:
-          break;
+          if(bLog)
+            {
+              LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                      INFO_LEVEL,
+                                      "PHYI %03hu MonitorPhy::%s subid %hu frequency %ju Hz committed %zu bytes",
+                                      id_,
+                                      __func__,
+                                      entry.first,
+                                      u64FrequencyHz,
+                                      bytes);
+            }
+
+          memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_NOISE_RECORDER,
+                                       entry.first,
+                                       u64FrequencyHz,
+                                       bytes);
+
+          subIdBytes += bytes;
         }
 
-      if(!bNoError)
+      if(bLog)
         {
           LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                  logLevel,
-                                  "PHYI %03hu MonitorPhy::%s "
-                                  " src %hu, dst %hu, drop %s",
+                                  INFO_LEVEL,
+                                  "PHYI %03hu MonitorPhy::%s subid %hu committed %zu bytes",
                                   id_,
                                   __func__,
-                                  pktInfo.getSource(),
-                                  pktInfo.getDestination(),
-                                  sReason.c_str());
-
-          // drop
-          return;
+                                  entry.first,
+                                  subIdBytes);
         }
+
+      memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_RECEIVE_PROCESSOR,
+                                   entry.first,
+                                   0,
+                                   std::get<2>(entry.second)->getCommittedBytes());
+
+      totalBytes += subIdBytes;
+    }
+
+  if(bLog)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              INFO_LEVEL,
+                              "PHYI %03hu MonitorPhy::%s noise recorder committed %zu bytes",
+                              id_,
+                              __func__,
+                              totalBytes);
+    }
+
+  if(bPublish)
+    {
+      memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_GAIN_GRID,
+                                   0,
+                                   0,
+                                   gainGridManager_.getCommittedBytes());
+
+      memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_EVENT_TABLE_STAGER,
+                                   0,
+                                   0,
+                                   eventTableStager_.getCommittedBytes());
+
+      memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_LAST_VALUE_CACHE,
+                                   0,
+                                   0,
+                                   lastValueCacheServer_.getCommittedBytes());
+
+      memoryTablePublisher_.update(MemoryTablePublisher::COMPONENT_RETAINED_HISTORY,
+                                   0,
+                                   0,
+                                   spectrumEnergyHistory_.getCommittedBytes());
+
+      memoryTablePublisher_.publish();
+
+      lastMemoryRefreshTime_ = now;
     }
 }
 
+template<typename Entries>
+void EMANE::SpectrumTools::MonitorPhy::updateEventTables(const Entries & entries)
+{
+  if(eventTableRefreshInterval_.count())
+    {
+      eventTableStager_.update(entries);
+    }
+  else
+    {
+      eventTablePublisher_.update(entries);
+    }
+}
 
 void EMANE::SpectrumTools::MonitorPhy::processEvent(const EventId & eventId,
                                                     const Serialization & serialization)
@@ -911,7 +3144,7 @@ void EMANE::SpectrumTools::MonitorPhy::processEvent(const EventId & eventId,
       {
         Events::AntennaProfileEvent antennaProfile{serialization};
         antennaManager_.update(antennaProfile.getAntennaProfiles());
-        eventTablePublisher_.update(antennaProfile.getAntennaProfiles());
+        updateEventTables(antennaProfile.getAntennaProfiles());
 
         LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
                                          DEBUG_LEVEL,
@@ -927,7 +3160,7 @@ void EMANE::SpectrumTools::MonitorPhy::processEvent(const EventId & eventId,
       {
         Events::FadingSelectionEvent fadingSelection{serialization};
         fadingManager_.update(fadingSelection.getFadingSelections());
-        eventTablePublisher_.update(fadingSelection.getFadingSelections());
+        updateEventTables(fadingSelection.getFadingSelections());
 
         LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
                                          DEBUG_LEVEL,
@@ -942,7 +3175,7 @@ void EMANE::SpectrumTools::MonitorPhy::processEvent(const EventId & eventId,
       {
         Events::LocationEvent locationEvent{serialization};
         locationManager_.update(locationEvent.getLocations());
-        eventTablePublisher_.update(locationEvent.getLocations());
+        updateEventTables(locationEvent.getLocations());
 
         LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
                                          DEBUG_LEVEL,
@@ -957,7 +3190,7 @@ void EMANE::SpectrumTools::MonitorPhy::processEvent(const EventId & eventId,
       {
         Events::PathlossEvent pathlossEvent{serialization};
         pPropagationModelAlgorithm_->update(pathlossEvent.getPathlosses());
-        eventTablePublisher_.update(pathlossEvent.getPathlosses());
+        updateEventTables(pathlossEvent.getPathlosses());
 
         LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
                                          DEBUG_LEVEL,
@@ -974,13 +3207,13 @@ std::uint64_t EMANE::SpectrumTools::MonitorPhy::getQueryIndex(const TimePoint &
 {
   std::uint64_t count = std::chrono::duration_cast<EMANE::Microseconds>(timePoint.time_since_epoch()).count();
 
-  return std::uint64_t{count / spectrumQueryRate_.count()};
+  return std::uint64_t{count / queryPeriod_.count()};
 }
 
 
 EMANE::TimePoint EMANE::SpectrumTools::MonitorPhy::getQueryTime(std::uint64_t u64QueryIndex)
 {
-  return TimePoint{u64QueryIndex * spectrumQueryRate_};
+  return TimePoint{u64QueryIndex * queryPeriod_};
 }
 
 
@@ -988,9 +3221,33 @@ void EMANE::SpectrumTools::MonitorPhy::querySpectrumService()
 {
   auto now = Clock::now();
 
-  std::uint64_t binSummaryCount = spectrumQueryRate_.count() / spectrumQueryBinSize_.count();
+  // refill fading variates off the receive path
+  if(pNakagamiVariatePool_)
+    {
+      *pNakagamiPoolDirectDraws_ += pNakagamiVariatePool_->refill();
+    }
+
+  collectStatisticCounters();
+
+  if(bLatencyHistogramEnable_)
+    {
+      latencyHistogramTable_.publish();
+    }
+
+  reportMemory(now);
+
+  // apply staged event table rows in one batch
+  if(eventTableRefreshInterval_.count() &&
+     now - lastEventTableRefreshTime_ >= eventTableRefreshInterval_)
+    {
+      eventTableStager_.refresh();
+
+      lastEventTableRefreshTime_ = now;
+    }
 
-  std::uint64_t currentQueryIndex{getQueryIndex(now)};
+  // a query runs the watermark after its period closes, zero unless
+  // streaming
+  std::uint64_t currentQueryIndex{getQueryIndex(now - queryWatermark_)};
 
   bool bScheduleQuery{};
 
@@ -1003,146 +3260,564 @@ void EMANE::SpectrumTools::MonitorPhy::querySpectrumService()
   // perfom a query
   if(currentQueryIndex - lastQueryIndex_ >= 1)
     {
-      EMANESpectrumMonitor::SpectrumEnergy msg{};
+      std::uint16_t u16DegradationLevel{};
+
+      if(bLoadGovernorEnable_)
+        {
+          // skipped queries count as a full query rate of lateness
+          auto lateness =
+            std::chrono::duration_cast<Microseconds>(now - queryWatermark_ - getQueryTime(currentQueryIndex)) +
+            queryPeriod_ * (currentQueryIndex - lastQueryIndex_ - 1);
 
-      auto startTime =  getQueryTime(lastQueryIndex_);
+          u16DegradationLevel = loadGovernor_.evaluate(queryPeriod_,lateness);
 
-      msg.set_start_time(std::chrono::duration_cast<Microseconds>(startTime.time_since_epoch()).count());
+          *pDegradationLevel_ = u16DegradationLevel;
+        }
+
+      processSubscriptions();
 
-      msg.set_duration(spectrumQueryBinSize_.count());
+      // without a recorder, ring or retention, only compute what is
+      // subscribed to
+      bool bPublishAll{recorderFileStream_.is_open() ||
+                       spectrumEnergyRingWriter_.isOpen() ||
+                       spectrumEnergyHistory_.isEnabled()};
 
-      msg.set_sequence(u64SequenceNumber_++);
+      bool bQuery{bPublishAll};
 
-      for(const auto & iter : spectrumMap_)
+      if(!bQuery)
         {
-          auto pEntry = msg.add_entries();
+          if(publishMode_ == PublishMode::SINGLE)
+            {
+              bQuery = subscriptionTracker_.isSubscribed(sSpectrumEnergyTopic_);
+            }
+          else
+            {
+              for(const auto & iter : spectrumMap_)
+                {
+                  if(subscriptionTracker_.isSubscribedWithin(getSubIdTopic(iter.first)))
+                    {
+                      bQuery = true;
+                      break;
+                    }
+                }
+            }
+        }
 
-          pEntry->set_subid(iter.first);
+      if(bQuery)
+        {
+          querySpectrumMonitors(getQueryTime(lastQueryIndex_),
+                                u16DegradationLevel,
+                                bPublishAll);
+        }
+      else
+        {
+          ++*pSpectrumQuerySkipped_;
+        }
 
-          pEntry->set_bandwidth_hz(std::get<0>(iter.second));
+      // schedule next query
+      lastQueryIndex_ = currentQueryIndex;
 
-          auto pSpectorMonintor = std::get<1>(iter.second).get();
+      bScheduleQuery = true;
+    }
 
-          for(const auto & frequencyHz : pSpectorMonintor->getFrequencies())
-            {
-              auto pEnergy = pEntry->add_energies();
+  if(bLoadGovernorEnable_)
+    {
+      loadGovernor_.addProcessingTime(std::chrono::duration_cast<Microseconds>(Clock::now() - now));
+    }
 
-              pEnergy->set_frequency_hz(frequencyHz);
+  // answered after the live query so it is never delayed by them
+  if(pZMQHistorySocket_)
+    {
+      processHistoryRequests();
+    }
 
-              auto window = pSpectorMonintor->request(frequencyHz,
-                                                      spectrumQueryRate_ * (currentQueryIndex - lastQueryIndex_),
-                                                      startTime);
+  if(bScheduleQuery)
+    {
+      timedEventId_ =
+        pPlatformService_->timerService().
+        schedule(std::bind(&MonitorPhy::querySpectrumService,
+                           this),
+                 getQueryTime(currentQueryIndex + 1) + queryWatermark_);
+    }
+}
 
-              for(std::uint64_t i = 0; i < binSummaryCount; ++i)
-                {
-                  pEnergy->add_energy_mw(maxNoiseBin(window,
-                                                     startTime + spectrumQueryBinSize_ * i,
-                                                     startTime + spectrumQueryBinSize_ * (i + 1) - Microseconds{1}));
-                }
-            }
-        }
 
-      const auto & localPOV = locationManager_.getLocalPOV();
+void EMANE::SpectrumTools::MonitorPhy::querySpectrumMonitors(const TimePoint & startTime,
+                                                             std::uint16_t u16DegradationLevel,
+                                                             bool bPublishAll)
+{
+  Microseconds queryBinSize{spectrumQueryBinSize_ * (std::uint64_t{1} << u16DegradationLevel)};
 
+  std::uint64_t binSummaryCount = queryPeriod_.count() / queryBinSize.count();
 
-      if(localPOV.isValid())
-        {
-          const auto & position = localPOV.getPosition();
+  // streamed bins are queried along with the revision bins before
+  // them, republished when late receptions change them
+  std::size_t revisionBins{streamingBinTracker_.getRevisionBins()};
 
-          auto * pPOV = msg.mutable_pov();
+  TimePoint windowStart{startTime - queryBinSize * revisionBins};
 
-          auto * pPosition = pPOV->mutable_position();
-          pPosition->set_latitude_degrees(position.getLatitudeDegrees());
-          pPosition->set_longitude_degrees(position.getLongitudeDegrees());
-          pPosition->set_altitude_meters(position.getAltitudeMeters());
+  std::size_t arenaSpaceAllocated{};
 
-          auto orientation = localPOV.getOrientation();
+  {
+    // build the message in an arena backed by a reusable block,
+    // no allocations once the block fits a query
+    google::protobuf::ArenaOptions arenaOptions{};
+    arenaOptions.initial_block = arenaBlock_.data();
+    arenaOptions.initial_block_size = arenaBlock_.size();
 
-          if(orientation.second)
-            {
-              auto * pOrientation = pPOV->mutable_orientation();
-              pOrientation->set_roll_degrees(orientation.first.getRollDegrees());
-              pOrientation->set_pitch_degrees(orientation.first.getPitchDegrees());
-              pOrientation->set_yaw_degrees(orientation.first.getYawDegrees());
-            }
+    google::protobuf::Arena arena{arenaOptions};
 
-          auto velocity = localPOV.getVelocity();
+    auto & msg =
+      *google::protobuf::Arena::CreateMessage<EMANESpectrumMonitor::SpectrumEnergy>(&arena);
 
-          if(velocity.second)
-            {
-              auto * pVelocity = pPOV->mutable_velocity();
-              pVelocity->set_azimuth_degrees(velocity.first.getAzimuthDegrees());
-              pVelocity->set_elevation_degrees(velocity.first.getElevationDegrees());
-              pVelocity->set_magnitude_meters_per_second(velocity.first.getMagnitudeMetersPerSecond());
-            }
-        }
+    msg.set_start_time(std::chrono::duration_cast<Microseconds>(startTime.time_since_epoch()).count());
 
-      auto pAntenna = msg.mutable_antenna();
+    msg.set_duration(queryBinSize.count());
 
-      if(optionalFixedAntennaGaindBi_.second)
-        {
-          pAntenna->set_fixed_gain_dbi(optionalFixedAntennaGaindBi_.first);
-        }
-      else
-        {
-          auto receiverAntennaInfo = antennaManager_.getAntennaInfo(id_,DEFAULT_ANTENNA_INDEX);
+    msg.set_sequence(u64SequenceNumber_++);
 
-          if(receiverAntennaInfo.second)
-            {
-              auto pointing = receiverAntennaInfo.first.antenna_.getPointing();
+    msg.set_degradation_level(u16DegradationLevel);
 
-              if(pointing.second)
-                {
-                  auto pPointing = pAntenna->mutable_pointing();
+    EMANE_SPECTRUM_TOOLS_PROBE3(query_start,
+                                msg.sequence(),
+                                msg.start_time(),
+                                u16DegradationLevel);
 
-                  pPointing->set_profile_id(pointing.first.getProfileId());
-                  pPointing->set_azimuth_degrees(pointing.first.getAzimuthDegrees());
-                  pPointing->set_elevation_degrees(pointing.first.getElevationDegrees());
-                }
-            }
-        }
+    LatencyHistogramTable::StageTimer stageTimer{bLatencyHistogramEnable_ ? &latencyHistogramTable_ : nullptr};
 
-      std::string sSerialization{};
+    const auto & localPOV = locationManager_.getLocalPOV();
 
-      if(msg.SerializeToString(&sSerialization))
-        {
-          std::string sTopic{"EMANE.SpectrumTools.MonitorPhy.SpectrumEnergy"};
+    if(localPOV.isValid())
+      {
+        const auto & position = localPOV.getPosition();
+
+        auto * pPOV = msg.mutable_pov();
+
+        auto * pPosition = pPOV->mutable_position();
+        pPosition->set_latitude_degrees(position.getLatitudeDegrees());
+        pPosition->set_longitude_degrees(position.getLongitudeDegrees());
+        pPosition->set_altitude_meters(position.getAltitudeMeters());
+
+        auto orientation = localPOV.getOrientation();
+
+        if(orientation.second)
+          {
+            auto * pOrientation = pPOV->mutable_orientation();
+            pOrientation->set_roll_degrees(orientation.first.getRollDegrees());
+            pOrientation->set_pitch_degrees(orientation.first.getPitchDegrees());
+            pOrientation->set_yaw_degrees(orientation.first.getYawDegrees());
+          }
+
+        auto velocity = localPOV.getVelocity();
+
+        if(velocity.second)
+          {
+            auto * pVelocity = pPOV->mutable_velocity();
+            pVelocity->set_azimuth_degrees(velocity.first.getAzimuthDegrees());
+            pVelocity->set_elevation_degrees(velocity.first.getElevationDegrees());
+            pVelocity->set_magnitude_meters_per_second(velocity.first.getMagnitudeMetersPerSecond());
+          }
+      }
 
-          if(zmq_send(pZMQSocket_,sTopic.c_str(),sTopic.length(),ZMQ_SNDMORE) < 0 ||
-             zmq_send(pZMQSocket_,sSerialization.c_str(),sSerialization.length(),0) < 0)
-            {
-              LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                      ERROR_LEVEL,
-                                      "PHYI %03hu SpectrumTools::MonitorPhy::%s zmq send error %s",
-                                      id_,
-                                      __func__,
-                                      zmq_strerror(errno));
-            }
+    auto pAntenna = msg.mutable_antenna();
 
-          if(recorderFileStream_.is_open())
-            {
-              std::uint32_t u32MessageFrameLength = htonl(sSerialization.length());
+    if(optionalFixedAntennaGaindBi_.second)
+      {
+        pAntenna->set_fixed_gain_dbi(optionalFixedAntennaGaindBi_.first);
+      }
+    else
+      {
+        auto receiverAntennaInfo = antennaManager_.getAntennaInfo(id_,DEFAULT_ANTENNA_INDEX);
 
-              recorderFileStream_.write(reinterpret_cast<char *>(&u32MessageFrameLength),
-                                        sizeof(u32MessageFrameLength));
+        if(receiverAntennaInfo.second)
+          {
+            auto pointing = receiverAntennaInfo.first.antenna_.getPointing();
 
-              recorderFileStream_.write(sSerialization.c_str(),sSerialization.length());
-            }
-        }
+            if(pointing.second)
+              {
+                auto pPointing = pAntenna->mutable_pointing();
 
-      // schedule next query
-      lastQueryIndex_ = currentQueryIndex;
+                pPointing->set_profile_id(pointing.first.getProfileId());
+                pPointing->set_azimuth_degrees(pointing.first.getAzimuthDegrees());
+                pPointing->set_elevation_degrees(pointing.first.getElevationDegrees());
+              }
+          }
+      }
 
-      bScheduleQuery = true;
-    }
+    // retained messages keep the antenna and pov, they are read
+    // back long after the metadata version they refer to
+    if(spectrumEnergyHistory_.isEnabled())
+      {
+        spectrumEnergyHistory_.begin(msg);
+      }
 
-  if(bScheduleQuery)
+    if(bMetadataEnable_)
+      {
+        // move the slow changing fields into a metadata message,
+        // published with a new version only when they change
+        auto & metadata =
+          *google::protobuf::Arena::CreateMessage<EMANESpectrumMonitor::SpectrumMetadata>(&arena);
+
+        metadata.set_version(0);
+
+        metadata.set_sequence(0);
+
+        metadata.mutable_antenna()->Swap(msg.mutable_antenna());
+
+        msg.clear_antenna();
+
+        if(msg.has_pov())
+          {
+            metadata.mutable_pov()->Swap(msg.mutable_pov());
+
+            msg.clear_pov();
+          }
+
+        for(const auto & iter : spectrumMap_)
+          {
+            auto pEntry = metadata.add_entries();
+
+            pEntry->set_subid(iter.first);
+
+            pEntry->set_bandwidth_hz(std::get<0>(iter.second));
+          }
+
+        metadata.SerializeToString(&sMetadataScratch_);
+
+        bool bPublishMetadata{};
+
+        if(sMetadataScratch_ != sMetadata_)
+          {
+            sMetadata_.swap(sMetadataScratch_);
+
+            ++u64MetadataVersion_;
+
+            bPublishMetadata = true;
+          }
+        else if(metadataRefreshInterval_.count() &&
+                startTime - lastMetadataPublishTime_ >= metadataRefreshInterval_)
+          {
+            bPublishMetadata = true;
+          }
+
+        if(bPublishMetadata)
+          {
+            metadata.set_version(u64MetadataVersion_);
+
+            metadata.set_sequence(msg.sequence());
+
+            publishSpectrumMetadata(metadata);
+
+            lastMetadataPublishTime_ = startTime;
+          }
+
+        msg.set_metadata_version(u64MetadataVersion_);
+      }
+
+    // revision parts by topic, published after the query
+    std::vector<std::pair<const std::string *,
+                          EMANESpectrumMonitor::SpectrumEnergy *>> revisions{};
+
+    auto addRevision = [&](std::uint16_t u16SubId,
+                           std::uint64_t u64BandwidthHz,
+                           const std::pair<std::uint64_t,std::vector<double>> & revision)
+      {
+        const std::string * pTopic{&sSpectrumEnergyTopic_};
+
+        if(publishMode_ != PublishMode::SINGLE)
+          {
+            std::uint64_t u64BlockStartHz{};
+
+            if(publishMode_ == PublishMode::FREQUENCY_BLOCK)
+              {
+                u64BlockStartHz = revision.first - revision.first % u64FrequencyBlockSizeHz_;
+              }
+
+            pTopic = &getSpectrumEnergyTopic(u16SubId,u64BlockStartHz);
+
+            if(!bPublishAll && !subscriptionTracker_.isSubscribed(*pTopic))
+              {
+                return;
+              }
+          }
+
+        auto iter = std::find_if(revisions.begin(),
+                                 revisions.end(),
+                                 [pTopic](const std::pair<const std::string *,
+                                          EMANESpectrumMonitor::SpectrumEnergy *> & part)
+                                 {
+                                   return part.first == pTopic;
+                                 });
+
+        if(iter == revisions.end())
+          {
+            auto pRevision =
+              google::protobuf::Arena::CreateMessage<EMANESpectrumMonitor::SpectrumEnergy>(&arena);
+
+            pRevision->set_start_time(std::chrono::duration_cast<Microseconds>(windowStart.time_since_epoch()).count());
+
+            pRevision->set_duration(queryBinSize.count());
+
+            pRevision->set_degradation_level(u16DegradationLevel);
+
+            pRevision->set_revision(true);
+
+            if(msg.has_antenna())
+              {
+                *pRevision->mutable_antenna() = msg.antenna();
+              }
+
+            if(msg.has_pov())
+              {
+                *pRevision->mutable_pov() = msg.pov();
+              }
+
+            if(msg.has_metadata_version())
+              {
+                pRevision->set_metadata_version(msg.metadata_version());
+              }
+
+            iter = revisions.emplace(revisions.end(),pTopic,pRevision);
+          }
+
+        auto pRevision = iter->second;
+
+        EMANESpectrumMonitor::SpectrumEnergy::Entry * pEntry{};
+
+        if(pRevision->entries_size() &&
+           pRevision->entries(pRevision->entries_size() - 1).subid() == u16SubId)
+          {
+            pEntry = pRevision->mutable_entries(pRevision->entries_size() - 1);
+          }
+        else
+          {
+            pEntry = pRevision->add_entries();
+
+            pEntry->set_subid(u16SubId);
+
+            if(!bMetadataEnable_)
+              {
+                pEntry->set_bandwidth_hz(u64BandwidthHz);
+              }
+          }
+
+        addEnergy(pEntry,revision);
+      };
+
+    if(publishMode_ == PublishMode::SINGLE)
+      {
+        for(const auto & iter : spectrumMap_)
+          {
+            auto pEntry = msg.add_entries();
+
+            pEntry->set_subid(iter.first);
+
+            if(!bMetadataEnable_)
+              {
+                pEntry->set_bandwidth_hz(std::get<0>(iter.second));
+              }
+
+            auto pSpectorMonintor = std::get<1>(iter.second).get();
+
+            auto summaries = pSpectorMonintor->maxSummary(windowStart,
+                                                          queryBinSize,
+                                                          binSummaryCount + revisionBins);
+
+            for(const auto & summary : summaries)
+              {
+                addEnergy(pEntry,summary,revisionBins);
+              }
+
+            if(spectrumEnergyHistory_.isEnabled())
+              {
+                spectrumEnergyHistory_.add(iter.first,std::get<0>(iter.second),summaries,revisionBins);
+              }
+
+            if(revisionBins)
+              {
+                // every frequency is published in single mode
+                for(const auto & revision : streamingBinTracker_.update(iter.first,
+                                                                        windowStart,
+                                                                        summaries,
+                                                                        [](std::uint64_t)
+                                                                        {
+                                                                          return true;
+                                                                        }))
+                  {
+                    addRevision(iter.first,std::get<0>(iter.second),revision);
+                  }
+              }
+          }
+
+        stageTimer.mark(LatencyHistogramTable::STAGE_QUERY);
+
+        publishSpectrumEnergy(sSpectrumEnergyTopic_,msg,stageTimer,true);
+      }
+    else
+      {
+        // each part carries the common fields along with the entry
+        // for a single sub id or sub id frequency block
+        std::vector<std::pair<const std::string *,
+                              EMANESpectrumMonitor::SpectrumEnergy *>> parts{};
+
+        for(const auto & iter : spectrumMap_)
+          {
+            if(!bPublishAll &&
+               !subscriptionTracker_.isSubscribedWithin(getSubIdTopic(iter.first)))
+              {
+                continue;
+              }
+
+            // entries by block start, null for blocks not subscribed to
+            std::map<std::uint64_t,EMANESpectrumMonitor::SpectrumEnergy::Entry *> blockEntries{};
+
+            auto getEntry = [&](std::uint64_t u64BlockStartHz) -> EMANESpectrumMonitor::SpectrumEnergy::Entry *
+              {
+                auto entryIter = blockEntries.find(u64BlockStartHz);
+
+                if(entryIter != blockEntries.end())
+                  {
+                    return entryIter->second;
+                  }
+
+                const auto & sTopic = getSpectrumEnergyTopic(iter.first,u64BlockStartHz);
+
+                EMANESpectrumMonitor::SpectrumEnergy::Entry * pEntry{};
+
+                if(bPublishAll || subscriptionTracker_.isSubscribed(sTopic))
+                  {
+                    auto pPart =
+                      google::protobuf::Arena::CreateMessage<EMANESpectrumMonitor::SpectrumEnergy>(&arena);
+
+                    pPart->CopyFrom(msg);
+
+                    parts.emplace_back(&sTopic,pPart);
+
+                    pEntry = pPart->add_entries();
+
+                    pEntry->set_subid(iter.first);
+
+                    if(!bMetadataEnable_)
+                      {
+                        pEntry->set_bandwidth_hz(std::get<0>(iter.second));
+                      }
+                  }
+
+                blockEntries.emplace(u64BlockStartHz,pEntry);
+
+                return pEntry;
+              };
+
+            // as with single mode, a sub id without energies is
+            // still published
+            if(publishMode_ == PublishMode::SUBID)
+              {
+                getEntry(0);
+              }
+
+            auto pSpectorMonintor = std::get<1>(iter.second).get();
+
+            auto summaries = pSpectorMonintor->maxSummary(windowStart,
+                                                          queryBinSize,
+                                                          binSummaryCount + revisionBins);
+
+            for(const auto & summary : summaries)
+              {
+                std::uint64_t u64BlockStartHz{};
+
+                if(publishMode_ == PublishMode::FREQUENCY_BLOCK)
+                  {
+                    u64BlockStartHz = summary.first - summary.first % u64FrequencyBlockSizeHz_;
+                  }
+
+                auto pEntry = getEntry(u64BlockStartHz);
+
+                if(pEntry)
+                  {
+                    addEnergy(pEntry,summary,revisionBins);
+                  }
+              }
+
+            if(spectrumEnergyHistory_.isEnabled())
+              {
+                spectrumEnergyHistory_.add(iter.first,std::get<0>(iter.second),summaries,revisionBins);
+              }
+
+            if(revisionBins)
+              {
+                // only frequencies in a block subscribed to are
+                // published, the same blocks their revisions go to
+                auto isPublished = [&](std::uint64_t u64FrequencyHz)
+                  {
+                    std::uint64_t u64BlockStartHz{};
+
+                    if(publishMode_ == PublishMode::FREQUENCY_BLOCK)
+                      {
+                        u64BlockStartHz = u64FrequencyHz - u64FrequencyHz % u64FrequencyBlockSizeHz_;
+                      }
+
+                    auto entryIter = blockEntries.find(u64BlockStartHz);
+
+                    return entryIter != blockEntries.end() && entryIter->second != nullptr;
+                  };
+
+                for(const auto & revision : streamingBinTracker_.update(iter.first,
+                                                                        windowStart,
+                                                                        summaries,
+                                                                        isPublished))
+                  {
+                    addRevision(iter.first,std::get<0>(iter.second),revision);
+                  }
+              }
+          }
+
+        stageTimer.mark(LatencyHistogramTable::STAGE_QUERY);
+
+        for(std::size_t i = 0; i < parts.size(); ++i)
+          {
+            parts[i].second->set_part_index(i);
+
+            parts[i].second->set_part_count(parts.size());
+
+            publishSpectrumEnergy(*parts[i].first,*parts[i].second,stageTimer,true);
+          }
+      }
+
+    // revisions follow the bin just published, sharing a sequence
+    // as the parts of a query do
+    if(!revisions.empty())
+      {
+        std::uint64_t u64Sequence{u64SequenceNumber_++};
+
+        for(std::size_t i = 0; i < revisions.size(); ++i)
+          {
+            revisions[i].second->set_sequence(u64Sequence);
+
+            if(publishMode_ != PublishMode::SINGLE)
+              {
+                revisions[i].second->set_part_index(i);
+
+                revisions[i].second->set_part_count(revisions.size());
+              }
+
+            publishSpectrumEnergy(*revisions[i].first,*revisions[i].second,stageTimer,false);
+          }
+
+        *pStreamingRevisions_ += revisions.size();
+      }
+
+    if(spectrumEnergyHistory_.isEnabled())
+      {
+        spectrumEnergyHistory_.end();
+      }
+
+    arenaSpaceAllocated = arena.SpaceAllocated();
+  }
+
+  // grow the arena block once the arena using it is gone
+  if(arenaSpaceAllocated > arenaBlock_.size())
     {
-      timedEventId_ =
-        pPlatformService_->timerService().
-        schedule(std::bind(&MonitorPhy::querySpectrumService,
-                           this),
-                 getQueryTime(currentQueryIndex + 1));
+      arenaBlock_.resize(arenaSpaceAllocated);
     }
 }
 
@@ -42,18 +42,47 @@
 #include "locationmanager.h"
 #include "spectrumservice.h"
 #include "gainmanager.h"
+#include "gaingridmanager.h"
 #include "antennamanager.h"
 #include "propagationmodelalgorithm.h"
 #include "eventtablepublisher.h"
+#include "eventtablestager.h"
 #include "receivepowertablepublisher.h"
 #include "fadingmanager.h"
+#include "lastvaluecacheserver.h"
+#include "latencyhistogramtable.h"
+#include "loadgovernor.h"
+#include "memorytablepublisher.h"
+#include "threadschedule.h"
 #include "receiveprocessoralt.h"
+#include "serializationbufferpool.h"
+#include "spectrumenergycompressor.h"
+#include "spectrumenergyhistory.h"
+#include "spectrumenergyringwriter.h"
 #include "spectrummonitoralt.h"
+#include "statisticcountershards.h"
+#include "streamingbintracker.h"
+#include "subscriptiontracker.h"
 
 #include <set>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <fstream>
+#include <string>
+#include <vector>
+
+namespace EMANESpectrumMonitor
+{
+  class SpectrumEnergy;
+  class SpectrumMetadata;
+  class SpectrumHistoryRequest;
+  class SpectrumHistoryRequest_Query;
+  class SpectrumHistoryResponse;
+  class SpectrumHistoryResponse_Result;
+  class SpectrumHistoryRequest_Retained;
+  class SpectrumHistoryResponse_RetainedResult;
+}
 
 namespace EMANE
 {
@@ -109,13 +138,24 @@ namespace EMANE
       SpectrumService * pSpectrumService_;
       AntennaManager antennaManager_;
       LocationManager locationManager_;
+
+      // shared by all sub-id receive processors, all use the same
+      // receive antenna so gain cache entries are sub-id independent
+      GainManager gainManager_;
+      GainGridManager gainGridManager_;
+      bool bAntennaGainGridEnable_;
+
       std::uint64_t u64BandwidthHz_;
       std::uint64_t u64RxCenterFrequencyHz_;
       std::uint64_t u64SubbandBinSizeHz_;
       std::pair<double,bool> optionalFixedAntennaGaindBi_;
       std::unique_ptr<PropagationModelAlgorithm> pPropagationModelAlgorithm_;
+      ReceiveProcessorAlt::Factory receiveProcessorAltFactory_;
       Utils::CommonLayerStatistics commonLayerStatistics_;
       EventTablePublisher eventTablePublisher_;
+      EventTableStager eventTableStager_;
+      Microseconds eventTableRefreshInterval_;
+      TimePoint lastEventTableRefreshTime_;
       ReceivePowerTablePublisher receivePowerTablePublisher_;
       Microseconds noiseBinSize_;
       Microseconds maxSegmentOffset_;
@@ -123,11 +163,50 @@ namespace EMANE
       Microseconds maxSegmentDuration_;
       Microseconds timeSyncThreshold_;
       bool bNoiseMaxClamp_;
+      NoiseRecorderBackend::Type noiseRecorderBackendType_;
+      HugePageMode noiseRecorderHugePageMode_;
       double dSystemNoiseFiguredB_;
       StatisticNumeric<std::uint64_t> * pTimeSyncThresholdRewrite_;
       StatisticNumeric<std::uint64_t> * pGainCacheHit_;
       StatisticNumeric<std::uint64_t> * pGainCacheMiss_;
+      StatisticNumeric<std::uint64_t> * pSpectrumClampOffset_;
+      StatisticNumeric<std::uint64_t> * pSpectrumClampDuration_;
+      StatisticNumeric<std::uint64_t> * pSpectrumClampPropagation_;
+      StatisticNumeric<std::uint64_t> * pNakagamiPoolDirectDraws_;
+      StatisticNumeric<std::uint64_t> * pDegradationLevel_;
+      StatisticNumeric<std::uint64_t> * pSpectrumQuerySkipped_;
+      StatisticNumeric<std::uint64_t> * pSpectrumSubscriptions_;
+      StatisticNumeric<std::uint64_t> * pLastValueCacheReplays_;
+      StatisticNumeric<std::uint64_t> * pSpectrumEnergyRingOversize_;
+      StatisticNumeric<std::uint64_t> * pSpectrumHistoryQueries_;
+      StatisticNumeric<std::uint64_t> * pSpectrumHistoryQueryErrors_;
+      StatisticNumeric<std::uint64_t> * pSpectrumHistoryGapFills_;
+      StatisticNumeric<std::uint64_t> * pRetainedHistoryDuration_;
+      StatisticNumeric<std::uint64_t> * pStreamingRevisions_;
+      StatisticNumeric<std::uint64_t> * pCompressedMessages_;
+      StatisticNumeric<std::uint64_t> * pCompressionDrops_;
+      StatisticNumeric<std::uint64_t> * pCompressionCPUTime_;
+      StatisticNumeric<double> * pCompressionRatio_;
+
+      // hot path statistics, collected into their statistic every
+      // spectrumquery.rate
+      enum StatisticCounter : std::size_t
+        {
+          COUNTER_GAIN_CACHE_HIT,
+          COUNTER_GAIN_CACHE_MISS,
+          COUNTER_SPECTRUM_CLAMP_OFFSET,
+          COUNTER_SPECTRUM_CLAMP_DURATION,
+          COUNTER_SPECTRUM_CLAMP_PROPAGATION,
+          COUNTER_COUNT,
+        };
+
+      StatisticCounterShards statisticCounterShards_;
+      LatencyHistogramTable latencyHistogramTable_;
+      bool bLatencyHistogramEnable_;
+
       FadingManager fadingManager_;
+      std::uint64_t u64NakagamiVariatePoolSize_;
+      std::unique_ptr<NakagamiVariatePool> pNakagamiVariatePool_;
       using SpectrumMap = std::map<std::uint16_t, // sub id
                                    std::tuple<std::uint64_t, // bandwidth hz
                                               std::unique_ptr<SpectrumMonitorAlt>,
@@ -146,19 +225,144 @@ namespace EMANE
       bool bRxSensitivityPromiscuousModeEnable_;
       Microseconds spectrumQueryRate_;
       Microseconds spectrumQueryBinSize_;
+      LoadGovernor loadGovernor_;
+      bool bLoadGovernorEnable_;
       INETAddr spectrumQueryPublishAddr_;
       TimerEventId timedEventId_;
       std::uint64_t lastQueryIndex_;
+      ThreadSchedule nemThreadSchedule_;
+      ThreadSchedule zmqThreadSchedule_;
       void * pZMQContext_;
       void * pZMQSocket_;
       std::uint64_t u64SequenceNumber_;
+      std::size_t memoryReportFrequencyCount_;
+      MemoryTablePublisher memoryTablePublisher_;
+      Microseconds memoryRefreshInterval_;
+      TimePoint lastMemoryRefreshTime_;
+      SerializationBufferPool serializationBufferPool_;
+      std::vector<char> arenaBlock_;
+
+      enum class PublishMode
+        {
+          SINGLE,
+          SUBID,
+          FREQUENCY_BLOCK,
+        };
+
+      PublishMode publishMode_;
+      std::uint64_t u64FrequencyBlockSizeHz_;
+
+      // hierarchical topics keyed by sub id and frequency block start
+      std::map<std::uint16_t,std::string> subIdTopics_;
+      using TopicKey = std::pair<std::uint16_t,std::uint64_t>;
+      std::map<TopicKey,std::string> spectrumEnergyTopics_;
+      SubscriptionTracker subscriptionTracker_;
+      bool bLastValueCacheEnable_;
+      INETAddr lastValueCacheAddr_;
+      LastValueCacheServer lastValueCacheServer_;
+      std::uint64_t u64LastValueCacheMessages_;
+      std::string sSpectrumEnergyRingName_;
+      std::uint64_t u64SpectrumEnergyRingSize_;
+      SpectrumEnergyRingWriter spectrumEnergyRingWriter_;
+
+      // single publish mode topic, suffixed when compressing
+      std::string sSpectrumEnergyTopic_;
+
+      // socket is shared with the compression thread when
+      // compression is enabled
+      std::mutex zmqSocketMutex_;
+      bool bCompressionEnable_;
+      std::int32_t iCompressionLevel_;
+      std::string sCompressionDictionaryFile_;
+      SpectrumEnergyCompressor spectrumEnergyCompressor_;
+      SpectrumEnergyCompressor::Counters compressionCounters_;
+      bool bMetadataEnable_;
+      Microseconds metadataRefreshInterval_;
+      std::uint64_t u64MetadataVersion_;
+
+      // serialized unversioned metadata last published, compared
+      // against each query to detect changes
+      std::string sMetadata_;
+      std::string sMetadataScratch_;
+      TimePoint lastMetadataPublishTime_;
+      std::string sSpectrumMetadataTopic_;
+      bool bSpectrumHistoryEnable_;
+      INETAddr spectrumHistoryAddr_;
+      std::uint64_t u64SpectrumHistoryMaxBins_;
+      std::uint64_t u64SpectrumHistoryMaxQueries_;
+      std::uint64_t u64SpectrumHistoryMaxNoiseBins_;
+      std::unique_ptr<EMANESpectrumMonitor::SpectrumHistoryRequest> pPendingHistoryRequest_;
+      void * pZMQHistorySocket_;
+      std::uint64_t u64RetentionTierSize_;
+      std::uint16_t u16RetentionTiers_;
+      SpectrumEnergyHistory spectrumEnergyHistory_;
+
+      // spectrumquery.rate, or spectrumquery.binsize when streaming
+      Microseconds queryPeriod_;
+
+      // delay after a query period closes before it is queried
+      Microseconds queryWatermark_;
+      StreamingBinTracker streamingBinTracker_;
 
       void querySpectrumService();
 
+      void querySpectrumMonitors(const TimePoint & startTime,
+                                 std::uint16_t u16DegradationLevel,
+                                 bool bPublishAll);
+
+      void processSubscriptions();
+
       TimePoint getQueryTime(std::uint64_t u64QueryIndex);
 
       std::uint64_t getQueryIndex(const TimePoint & timePoint);
 
+      void configureNakagamiVariatePool(const ConfigurationUpdate & update);
+
+      void reportMemory(const TimePoint & now);
+
+      void applyNEMThreadSchedule();
+
+      void collectStatisticCounters();
+
+      const std::string & getSubIdTopic(std::uint16_t u16SubId);
+
+      const std::string & getSpectrumEnergyTopic(std::uint16_t u16SubId,
+                                                 std::uint64_t u64BlockStartHz);
+
+      void publishSpectrumEnergy(const std::string & sTopic,
+                                 const EMANESpectrumMonitor::SpectrumEnergy & msg,
+                                 LatencyHistogramTable::StageTimer & stageTimer,
+                                 bool bLastValue);
+
+      void processHistoryRequests();
+
+      std::uint64_t getHistoryRequestCost(const EMANESpectrumMonitor::SpectrumHistoryRequest & request) const;
+
+      void answerHistoryRequest(const EMANESpectrumMonitor::SpectrumHistoryRequest & request,
+                                EMANESpectrumMonitor::SpectrumHistoryResponse * pResponse);
+
+      bool answerHistoryQuery(const EMANESpectrumMonitor::SpectrumHistoryRequest_Query & query,
+                              EMANESpectrumMonitor::SpectrumHistoryResponse_Result * pResult);
+
+      bool answerRetainedQuery(const EMANESpectrumMonitor::SpectrumHistoryRequest_Retained & retained,
+                               EMANESpectrumMonitor::SpectrumHistoryResponse_RetainedResult * pResult);
+
+      void publishSpectrumMetadata(const EMANESpectrumMonitor::SpectrumMetadata & msg);
+
+      void publishSerialized(const std::string & sTopic,
+                             std::uint64_t u64Sequence,
+                             SerializationBufferPool::Buffer * pBuffer,
+                             bool bMetadata,
+                             bool bLastValue);
+
+      void sendSpectrumEnergy(const std::string & sTopic,
+                              std::uint64_t u64Sequence,
+                              bool bLastValue,
+                              SerializationBufferPool::Buffer * pBuffer);
+
+      template<typename Entries>
+      void updateEventTables(const Entries & entries);
+
       std::string sSpectrumQueryRecorderFile_;
       std::fstream recorderFileStream_;
     };
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "nakagamivariatepool.h"
+
+#include "emane/utils/conversionutils.h"
+
+#include <algorithm>
+
+EMANE::SpectrumTools::NakagamiVariatePool::NakagamiVariatePool(std::size_t poolSize):
+  poolSize_{poolSize},
+  pools_{},
+  dDistance0Meters_{},
+  dDistance1Meters_{},
+  u64DirectDraws_{},
+  generator_{std::random_device{}()}{}
+
+void EMANE::SpectrumTools::NakagamiVariatePool::setM(std::size_t index, double dm)
+{
+  auto & pool = pools_.at(index);
+
+  if(pool.dm_ != dm)
+    {
+      pool.dm_ = dm;
+
+      // variates for the previous m no longer apply
+      pool.variates_.clear();
+    }
+}
+
+void EMANE::SpectrumTools::NakagamiVariatePool::setDistance0Meters(double dDistanceMeters)
+{
+  dDistance0Meters_ = dDistanceMeters;
+}
+
+void EMANE::SpectrumTools::NakagamiVariatePool::setDistance1Meters(double dDistanceMeters)
+{
+  dDistance1Meters_ = dDistanceMeters;
+}
+
+bool EMANE::SpectrumTools::NakagamiVariatePool::isConfigured() const
+{
+  for(const auto & pool : pools_)
+    {
+      if(pool.dm_ <= 0)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+void EMANE::SpectrumTools::NakagamiVariatePool::fade(const double * pPowerdBm,
+                                                     double * pRxPowerMilliWatt,
+                                                     std::size_t count,
+                                                     double dDistanceMeters)
+{
+  auto & pool = pools_[dDistanceMeters < dDistance0Meters_ ? 0 :
+                       dDistanceMeters < dDistance1Meters_ ? 1 : 2];
+
+  const double dScale{1.0 / pool.dm_};
+
+  std::size_t pooled{std::min(count,pool.variates_.size())};
+
+  // consume from the end of the pool
+  const double * pVariates{pool.variates_.data() + pool.variates_.size() - pooled};
+
+  for(std::size_t i = 0; i < pooled; ++i)
+    {
+      pRxPowerMilliWatt[i] = Utils::DB_TO_MILLIWATT(pPowerdBm[i]) * dScale * pVariates[i];
+    }
+
+  pool.variates_.resize(pool.variates_.size() - pooled);
+
+  if(pooled < count)
+    {
+      std::gamma_distribution<double> distribution{pool.dm_,1.0};
+
+      for(std::size_t i = pooled; i < count; ++i)
+        {
+          pRxPowerMilliWatt[i] =
+            Utils::DB_TO_MILLIWATT(pPowerdBm[i]) * dScale * distribution(generator_);
+        }
+
+      u64DirectDraws_ += count - pooled;
+    }
+}
+
+std::uint64_t EMANE::SpectrumTools::NakagamiVariatePool::refill()
+{
+  for(auto & pool : pools_)
+    {
+      if(pool.dm_ > 0)
+        {
+          std::gamma_distribution<double> distribution{pool.dm_,1.0};
+
+          pool.variates_.reserve(poolSize_);
+
+          while(pool.variates_.size() < poolSize_)
+            {
+              pool.variates_.push_back(distribution(generator_));
+            }
+        }
+    }
+
+  auto u64DirectDraws = u64DirectDraws_;
+
+  u64DirectDraws_ = 0;
+
+  return u64DirectDraws;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSNAKAGAMIVARIATEPOOL_HEADER_
+#define EMANESPECTRUMTOOLSNAKAGAMIVARIATEPOOL_HEADER_
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class NakagamiVariatePool
+     *
+     * @brief Pools of pre-generated unit Gamma(m,1) variates, one per
+     * nakagami distance band (m0, m1, m2).
+     *
+     * A nakagami faded power is Gamma(m,P/m) distributed, which is
+     * (P/m) * Gamma(m,1), so pooled unit variates scaled by the
+     * segment power are statistically equivalent to drawing from
+     * Gamma(m,P/m) directly. Pools are refilled off the receive path,
+     * when exhausted variates are drawn directly.
+     */
+    class NakagamiVariatePool
+    {
+    public:
+      explicit NakagamiVariatePool(std::size_t poolSize);
+
+      void setM(std::size_t index, double dm);
+
+      void setDistance0Meters(double dDistanceMeters);
+
+      void setDistance1Meters(double dDistanceMeters);
+
+      bool isConfigured() const;
+
+      /**
+       * Fades count powers using pooled variates for the distance
+       * band of dDistanceMeters
+       *
+       * @param pPowerdBm Powers in dBm
+       * @param pRxPowerMilliWatt Faded powers in mW
+       * @param count Number of powers
+       * @param dDistanceMeters Distance between transmitter and receiver
+       */
+      void fade(const double * pPowerdBm,
+                double * pRxPowerMilliWatt,
+                std::size_t count,
+                double dDistanceMeters);
+
+      /**
+       * Refills all pools
+       *
+       * @return Number of variates drawn directly since the last refill
+       */
+      std::uint64_t refill();
+
+    private:
+      struct Pool
+      {
+        double dm_{};
+        std::vector<double> variates_{};
+      };
+
+      std::size_t poolSize_;
+      std::array<Pool,3> pools_;
+      double dDistance0Meters_;
+      double dDistance1Meters_;
+      std::uint64_t u64DirectDraws_;
+      std::mt19937 generator_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSNAKAGAMIVARIATEPOOL_HEADER_
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "noisematrixbackend.h"
+
+#include "emane/utils/spectrumwindowutils.h"
+
+#include <algorithm>
+
+EMANE::SpectrumTools::NoiseMatrixBackend::NoiseMatrixBackend(const Microseconds & binSize,
+                                                             const Microseconds & maxOffset,
+                                                             const Microseconds & maxPropagation,
+                                                             const Microseconds & maxDuration,
+                                                             HugePageMode hugePageMode):
+  binSize_{binSize},
+  totalWindowBins_{(maxOffset + maxPropagation + 2 * maxDuration) / binSize},
+  totalRingBins_{2 * totalWindowBins_ + 1},
+  horizonBin_{-1},
+  rowCount_{},
+  rowStride_{},
+  rowIndexMap_{},
+  energy_(HugePageAllocator<double>{hugePageMode}){}
+
+std::size_t
+EMANE::SpectrumTools::NoiseMatrixBackend::findOrInsert(std::uint64_t u64FrequencyHz)
+{
+  auto iter = rowIndexMap_.find(u64FrequencyHz);
+
+  if(iter != rowIndexMap_.end())
+    {
+      return iter->second;
+    }
+
+  // grow the row stride geometrically and relayout each column
+  if(rowCount_ == rowStride_)
+    {
+      std::size_t newRowStride{std::max<std::size_t>(4,rowStride_ * 2)};
+
+      Energy energy(totalRingBins_ * newRowStride,0,energy_.get_allocator());
+
+      for(Microseconds::rep i = 0; i < totalRingBins_; ++i)
+        {
+          std::copy_n(energy_.data() + i * rowStride_,
+                      rowCount_,
+                      energy.data() + i * newRowStride);
+        }
+
+      energy_.swap(energy);
+
+      rowStride_ = newRowStride;
+    }
+
+  rowIndexMap_.insert(std::make_pair(u64FrequencyHz,rowCount_));
+
+  return rowCount_++;
+}
+
+void EMANE::SpectrumTools::NoiseMatrixBackend::advance(Microseconds::rep horizonBin)
+{
+  if(horizonBin <= horizonBin_)
+    {
+      return;
+    }
+
+  if(horizonBin_ < 0 || horizonBin - horizonBin_ >= totalRingBins_)
+    {
+      std::fill(energy_.begin(),energy_.end(),0);
+    }
+  else
+    {
+      // zero the columns being reused for the new bins
+      for(auto bin = horizonBin_ + 1; bin <= horizonBin; ++bin)
+        {
+          std::fill_n(column(bin),rowStride_,0);
+        }
+    }
+
+  horizonBin_ = horizonBin;
+}
+
+bool EMANE::SpectrumTools::NoiseMatrixBackend::isValidBin(Microseconds::rep bin) const
+{
+  return horizonBin_ >= 0 && bin <= horizonBin_ && bin > horizonBin_ - totalRingBins_;
+}
+
+const double *
+EMANE::SpectrumTools::NoiseMatrixBackend::column(Microseconds::rep bin) const
+{
+  return energy_.data() + (bin % totalRingBins_) * rowStride_;
+}
+
+double *
+EMANE::SpectrumTools::NoiseMatrixBackend::column(Microseconds::rep bin)
+{
+  return energy_.data() + (bin % totalRingBins_) * rowStride_;
+}
+
+void EMANE::SpectrumTools::NoiseMatrixBackend::addFrequency(std::uint64_t u64FrequencyHz,
+                                                            std::uint64_t)
+{
+  findOrInsert(u64FrequencyHz);
+}
+
+std::pair<EMANE::TimePoint,EMANE::TimePoint>
+EMANE::SpectrumTools::NoiseMatrixBackend::update(const TimePoint & now,
+                                                 const TimePoint & txTime,
+                                                 const Microseconds & offset,
+                                                 const Microseconds & propagation,
+                                                 const Microseconds & duration,
+                                                 std::uint64_t u64FrequencyHz,
+                                                 std::uint64_t,
+                                                 double dRxPowerMilliWatt,
+                                                 const std::vector<NEMId> &,
+                                                 std::uint64_t,
+                                                 std::uint64_t,
+                                                 AntennaIndex)
+{
+  auto row = findOrInsert(u64FrequencyHz);
+
+  auto nowBin = Utils::timepointToAbsoluteBin(now,binSize_,false);
+
+  advance(nowBin + totalWindowBins_);
+
+  auto startOfReception = txTime + offset + propagation;
+
+  auto endOfReception = startOfReception + duration;
+
+  auto startOfReceptionBin = Utils::timepointToAbsoluteBin(startOfReception,binSize_,false);
+
+  auto endOfReceptionBin = std::max(startOfReceptionBin,
+                                    Utils::timepointToAbsoluteBin(endOfReception,binSize_,true));
+
+  // reception ended before the start of the noise window
+  if(endOfReceptionBin <= nowBin - totalWindowBins_)
+    {
+      return std::make_pair(startOfReception,endOfReception);
+    }
+
+  startOfReceptionBin = std::max(startOfReceptionBin,nowBin - totalWindowBins_ + 1);
+
+  endOfReceptionBin = std::min(endOfReceptionBin,horizonBin_);
+
+  for(auto bin = startOfReceptionBin; bin <= endOfReceptionBin; ++bin)
+    {
+      column(bin)[row] += dRxPowerMilliWatt;
+    }
+
+  return std::make_pair(startOfReception,endOfReception);
+}
+
+EMANE::FrequencySet
+EMANE::SpectrumTools::NoiseMatrixBackend::getFrequencies() const
+{
+  FrequencySet frequencySet;
+
+  for(auto & entry : rowIndexMap_)
+    {
+      frequencySet.insert(entry.first);
+    }
+
+  return frequencySet;
+}
+
+EMANE::SpectrumWindow
+EMANE::SpectrumTools::NoiseMatrixBackend::get(const TimePoint & now,
+                                              std::uint64_t u64FrequencyHz,
+                                              const Microseconds & duration,
+                                              const TimePoint & timepoint) const
+{
+  const auto iter = rowIndexMap_.find(u64FrequencyHz);
+
+  if(iter == rowIndexMap_.end())
+    {
+      return SpectrumWindow{{},{},{},{},false};
+    }
+
+  auto nowBin = Utils::timepointToAbsoluteBin(now,binSize_,false);
+
+  Microseconds::rep startBin{};
+  Microseconds::rep endBin{};
+
+  if(timepoint == TimePoint::min())
+    {
+      endBin = nowBin;
+
+      startBin = duration == Microseconds::zero() ?
+        nowBin - totalWindowBins_ + 1 :
+        Utils::timepointToAbsoluteBin(now - duration,binSize_,false);
+    }
+  else
+    {
+      startBin = Utils::timepointToAbsoluteBin(timepoint,binSize_,false);
+
+      endBin = duration == Microseconds::zero() ?
+        nowBin :
+        Utils::timepointToAbsoluteBin(timepoint + duration,binSize_,true);
+    }
+
+  startBin = std::max(startBin,nowBin - totalWindowBins_ + 1);
+
+  endBin = std::min(std::max(startBin,endBin),startBin + totalRingBins_ - 1);
+
+  std::vector<double> energies(endBin - startBin + 1,0);
+
+  for(auto bin = startBin; bin <= endBin; ++bin)
+    {
+      if(isValidBin(bin))
+        {
+          energies[bin - startBin] = column(bin)[iter->second];
+        }
+    }
+
+  return SpectrumWindow{std::move(energies),
+      TimePoint{Microseconds{startBin * binSize_.count()}},
+      binSize_,
+      0,
+      true};
+}
+
+std::vector<double>
+EMANE::SpectrumTools::NoiseMatrixBackend::dump(std::uint64_t u64FrequencyHz) const
+{
+  const auto iter = rowIndexMap_.find(u64FrequencyHz);
+
+  if(iter == rowIndexMap_.end())
+    {
+      return {};
+    }
+
+  std::vector<double> energies(totalRingBins_,0);
+
+  for(Microseconds::rep i = 0; i < totalRingBins_; ++i)
+    {
+      auto bin = horizonBin_ - totalRingBins_ + 1 + i;
+
+      if(isValidBin(bin))
+        {
+          energies[i] = column(bin)[iter->second];
+        }
+    }
+
+  return energies;
+}
+
+std::size_t
+EMANE::SpectrumTools::NoiseMatrixBackend::getCommittedBytes(std::uint64_t u64FrequencyHz) const
+{
+  if(!rowIndexMap_.count(u64FrequencyHz))
+    {
+      return 0;
+    }
+
+  return energy_.capacity() * sizeof(double) / rowCount_;
+}
+
+EMANE::SpectrumTools::NoiseRecorderBackend::EnergySummary
+EMANE::SpectrumTools::NoiseMatrixBackend::maxSummary(const TimePoint &,
+                                                     const TimePoint & startTime,
+                                                     const Microseconds & summaryBinSize,
+                                                     std::size_t summaryBinCount) const
+{
+  EnergySummary summary{};
+
+  // summary bin major scratch, one max per row for each summary bin
+  std::vector<double> maxima(summaryBinCount * rowCount_,0);
+
+  for(std::size_t i = 0; i < summaryBinCount; ++i)
+    {
+      auto startBin =
+        Utils::timepointToAbsoluteBin(startTime + summaryBinSize * i,
+                                      binSize_,
+                                      false);
+
+      auto endBin =
+        Utils::timepointToAbsoluteBin(startTime + summaryBinSize * (i + 1) - Microseconds{1},
+                                      binSize_,
+                                      true);
+
+      startBin = std::max(startBin,horizonBin_ - totalRingBins_ + 1);
+
+      endBin = std::min(endBin,horizonBin_);
+
+      double * pMaxima = maxima.data() + i * rowCount_;
+
+      for(auto bin = startBin; bin <= endBin; ++bin)
+        {
+          const double * pColumn = column(bin);
+
+          for(std::size_t row = 0; row < rowCount_; ++row)
+            {
+              pMaxima[row] = pMaxima[row] < pColumn[row] ? pColumn[row] : pMaxima[row];
+            }
+        }
+    }
+
+  summary.reserve(rowIndexMap_.size());
+
+  for(const auto & entry : rowIndexMap_)
+    {
+      std::vector<double> energies(summaryBinCount);
+
+      for(std::size_t i = 0; i < summaryBinCount; ++i)
+        {
+          energies[i] = maxima[i * rowCount_ + entry.second];
+        }
+
+      summary.emplace_back(entry.first,std::move(energies));
+    }
+
+  return summary;
+}
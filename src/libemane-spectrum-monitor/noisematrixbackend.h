@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSNOISEMATRIXBACKEND_HEADER_
+#define EMANESPECTRUMTOOLSNOISEMATRIXBACKEND_HEADER_
+
+#include "noiserecorderbackend.h"
+#include "hugepageallocator.h"
+
+#include <map>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class NoiseMatrixBackend
+     *
+     * @brief Noise recorder backend storing the energy of all
+     * frequencies in a single contiguous time bin x frequency ring.
+     *
+     * @note Each ring column holds one time bin for every frequency
+     * row, so the per bin max reductions used by maxSummary operate
+     * on contiguous memory across frequencies. The ring spans the
+     * noise window on either side of the current time bin, and
+     * columns are zeroed as they are reused.
+     */
+    class NoiseMatrixBackend : public NoiseRecorderBackend
+    {
+    public:
+      NoiseMatrixBackend(const Microseconds & binSize,
+                         const Microseconds & maxOffset,
+                         const Microseconds & maxPropagation,
+                         const Microseconds & maxDuration,
+                         HugePageMode hugePageMode);
+
+      void addFrequency(std::uint64_t u64FrequencyHz,
+                        std::uint64_t u64BandwidthHz) override;
+
+      std::pair<TimePoint,TimePoint>
+      update(const TimePoint & now,
+             const TimePoint & txTime,
+             const Microseconds & offset,
+             const Microseconds & propagation,
+             const Microseconds & duration,
+             std::uint64_t u64FrequencyHz,
+             std::uint64_t u64BandwidthHz,
+             double dRxPowerMilliWatt,
+             const std::vector<NEMId> & transmitters,
+             std::uint64_t u64LowerOverlapFrequencyHz,
+             std::uint64_t u64UpperOverlapFrequencyHz,
+             AntennaIndex txAntennaIndex) override;
+
+      FrequencySet getFrequencies() const override;
+
+      SpectrumWindow get(const TimePoint & now,
+                         std::uint64_t u64FrequencyHz,
+                         const Microseconds & duration,
+                         const TimePoint & timepoint) const override;
+
+      std::vector<double> dump(std::uint64_t u64FrequencyHz) const override;
+
+      std::size_t getCommittedBytes(std::uint64_t u64FrequencyHz) const override;
+
+      EnergySummary maxSummary(const TimePoint & now,
+                               const TimePoint & startTime,
+                               const Microseconds & summaryBinSize,
+                               std::size_t summaryBinCount) const override;
+
+    private:
+      using RowIndexMap = std::map<std::uint64_t,std::size_t>;
+      using Energy = std::vector<double,HugePageAllocator<double>>;
+
+      Microseconds binSize_;
+      Microseconds::rep totalWindowBins_;
+      Microseconds::rep totalRingBins_;
+      Microseconds::rep horizonBin_;
+      std::size_t rowCount_;
+      std::size_t rowStride_;
+      RowIndexMap rowIndexMap_;
+      Energy energy_;
+
+      std::size_t findOrInsert(std::uint64_t u64FrequencyHz);
+
+      void advance(Microseconds::rep horizonBin);
+
+      bool isValidBin(Microseconds::rep bin) const;
+
+      const double * column(Microseconds::rep bin) const;
+
+      double * column(Microseconds::rep bin);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSNOISEMATRIXBACKEND_HEADER_
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "noiserecorderbackend.h"
+#include "maxnoisebin.h"
+
+EMANE::SpectrumTools::NoiseRecorderBackend::EnergySummary
+EMANE::SpectrumTools::NoiseRecorderBackend::maxSummary(const TimePoint & now,
+                                                       const TimePoint & startTime,
+                                                       const Microseconds & summaryBinSize,
+                                                       std::size_t summaryBinCount) const
+{
+  EnergySummary summary{};
+
+  for(const auto & frequencyHz : getFrequencies())
+    {
+      auto window = get(now,
+                        frequencyHz,
+                        summaryBinSize * summaryBinCount,
+                        startTime);
+
+      std::vector<double> energies{};
+
+      energies.reserve(summaryBinCount);
+
+      for(std::size_t i = 0; i < summaryBinCount; ++i)
+        {
+          energies.push_back(maxNoiseBin(window,
+                                         startTime + summaryBinSize * i,
+                                         startTime + summaryBinSize * (i + 1) - Microseconds{1}));
+        }
+
+      summary.emplace_back(frequencyHz,std::move(energies));
+    }
+
+  return summary;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSNOISERECORDERBACKEND_HEADER_
+#define EMANESPECTRUMTOOLSNOISERECORDERBACKEND_HEADER_
+
+#include "emane/types.h"
+#include "emane/spectrumserviceprovider.h"
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class NoiseRecorderBackend
+     *
+     * @brief Storage used by SpectrumMonitorAlt to record binned
+     * receive energy for all frequencies of a single sub id.
+     */
+    class NoiseRecorderBackend
+    {
+    public:
+      enum class Type
+        {
+          MAP,
+          MATRIX,
+          SEGMENTTREE,
+        };
+
+      // frequency hz, max energy mW per summary bin
+      using EnergySummary =
+        std::vector<std::pair<std::uint64_t,std::vector<double>>>;
+
+      virtual ~NoiseRecorderBackend(){}
+
+      virtual void addFrequency(std::uint64_t u64FrequencyHz,
+                                std::uint64_t u64BandwidthHz) = 0;
+
+      virtual std::pair<TimePoint,TimePoint>
+      update(const TimePoint & now,
+             const TimePoint & txTime,
+             const Microseconds & offset,
+             const Microseconds & propagation,
+             const Microseconds & duration,
+             std::uint64_t u64FrequencyHz,
+             std::uint64_t u64BandwidthHz,
+             double dRxPowerMilliWatt,
+             const std::vector<NEMId> & transmitters,
+             std::uint64_t u64LowerOverlapFrequencyHz,
+             std::uint64_t u64UpperOverlapFrequencyHz,
+             AntennaIndex txAntennaIndex) = 0;
+
+      virtual FrequencySet getFrequencies() const = 0;
+
+      virtual SpectrumWindow get(const TimePoint & now,
+                                 std::uint64_t u64FrequencyHz,
+                                 const Microseconds & duration,
+                                 const TimePoint & timepoint) const = 0;
+
+      virtual std::vector<double> dump(std::uint64_t u64FrequencyHz) const = 0;
+
+      /**
+       * Gets the storage committed to a frequency in bytes. Storage
+       * shared by all frequencies is divided evenly among them.
+       */
+      virtual std::size_t getCommittedBytes(std::uint64_t u64FrequencyHz) const = 0;
+
+      /**
+       * Gets the max energy of each summary bin for every known
+       * frequency, where summary bin i covers [startTime + i *
+       * summaryBinSize, startTime + (i + 1) * summaryBinSize).
+       *
+       * The default implementation requests a window per frequency
+       * and scans it once per summary bin.
+       */
+      virtual EnergySummary maxSummary(const TimePoint & now,
+                                       const TimePoint & startTime,
+                                       const Microseconds & summaryBinSize,
+                                       std::size_t summaryBinCount) const;
+
+    protected:
+      NoiseRecorderBackend() = default;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSNOISERECORDERBACKEND_HEADER_
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "noiserecordermapbackend.h"
+
+EMANE::SpectrumTools::NoiseRecorderMapBackend::NoiseRecorderMapBackend(const Microseconds & binSize,
+                                                                       const Microseconds & maxOffset,
+                                                                       const Microseconds & maxPropagation,
+                                                                       const Microseconds & maxDuration):
+  binSize_{binSize},
+  maxOffset_{maxOffset},
+  maxPropagation_{maxPropagation},
+  maxDuration_{maxDuration}{}
+
+EMANE::SpectrumTools::NoiseRecorderMapBackend::NoiseRecorderMap::iterator
+EMANE::SpectrumTools::NoiseRecorderMapBackend::findOrInsert(std::uint64_t u64FrequencyHz,
+                                                            std::uint64_t u64BandwidthHz)
+{
+  auto iter = noiseRecorderMap_.find(u64FrequencyHz);
+
+  if(iter == noiseRecorderMap_.end())
+    {
+      iter = noiseRecorderMap_.insert(std::make_pair(u64FrequencyHz,
+                                                     std::unique_ptr<NoiseRecorder>{new NoiseRecorder{binSize_,
+                                                           maxOffset_,
+                                                           maxPropagation_,
+                                                           maxDuration_,
+                                                           0,
+                                                           u64FrequencyHz,
+                                                           u64BandwidthHz,
+                                                           0}})).first;
+    }
+
+  return iter;
+}
+
+void EMANE::SpectrumTools::NoiseRecorderMapBackend::addFrequency(std::uint64_t u64FrequencyHz,
+                                                                 std::uint64_t u64BandwidthHz)
+{
+  findOrInsert(u64FrequencyHz,u64BandwidthHz);
+}
+
+std::pair<EMANE::TimePoint,EMANE::TimePoint>
+EMANE::SpectrumTools::NoiseRecorderMapBackend::update(const TimePoint & now,
+                                                      const TimePoint & txTime,
+                                                      const Microseconds & offset,
+                                                      const Microseconds & propagation,
+                                                      const Microseconds & duration,
+                                                      std::uint64_t u64FrequencyHz,
+                                                      std::uint64_t u64BandwidthHz,
+                                                      double dRxPowerMilliWatt,
+                                                      const std::vector<NEMId> & transmitters,
+                                                      std::uint64_t u64LowerOverlapFrequencyHz,
+                                                      std::uint64_t u64UpperOverlapFrequencyHz,
+                                                      AntennaIndex txAntennaIndex)
+{
+  auto iter = findOrInsert(u64FrequencyHz,u64BandwidthHz);
+
+  return iter->second->update(now,
+                              txTime,
+                              offset,
+                              propagation,
+                              duration,
+                              dRxPowerMilliWatt,
+                              transmitters,
+                              u64LowerOverlapFrequencyHz,
+                              u64UpperOverlapFrequencyHz,
+                              txAntennaIndex);
+}
+
+EMANE::FrequencySet
+EMANE::SpectrumTools::NoiseRecorderMapBackend::getFrequencies() const
+{
+  FrequencySet frequencySet;
+
+  for(auto & entry : noiseRecorderMap_)
+    {
+      frequencySet.insert(entry.first);
+    }
+
+  return frequencySet;
+}
+
+EMANE::SpectrumWindow
+EMANE::SpectrumTools::NoiseRecorderMapBackend::get(const TimePoint & now,
+                                                   std::uint64_t u64FrequencyHz,
+                                                   const Microseconds & duration,
+                                                   const TimePoint & timepoint) const
+{
+  const auto iter = noiseRecorderMap_.find(u64FrequencyHz);
+
+  if(iter != noiseRecorderMap_.end())
+    {
+      auto ret = iter->second->get(now,duration,timepoint);
+
+      return std::tuple_cat(std::move(ret),std::make_tuple(binSize_,0,true));
+    }
+  else
+    {
+      return SpectrumWindow{{},{},{},{},false};
+    }
+}
+
+std::vector<double>
+EMANE::SpectrumTools::NoiseRecorderMapBackend::dump(std::uint64_t u64FrequencyHz) const
+{
+  const auto iter = noiseRecorderMap_.find(u64FrequencyHz);
+
+  if(iter != noiseRecorderMap_.end())
+    {
+      return iter->second->dump();
+    }
+
+  return {};
+}
+
+std::size_t
+EMANE::SpectrumTools::NoiseRecorderMapBackend::getCommittedBytes(std::uint64_t u64FrequencyHz) const
+{
+  if(!noiseRecorderMap_.count(u64FrequencyHz))
+    {
+      return 0;
+    }
+
+  // estimate, NoiseRecorder does not report its storage: an energy
+  // and a bin time for each noise window bin
+  auto totalWindowBins = (maxOffset_ + maxPropagation_ + 2 * maxDuration_) / binSize_;
+
+  return totalWindowBins * (sizeof(double) + sizeof(TimePoint));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSNOISERECORDERMAPBACKEND_HEADER_
+#define EMANESPECTRUMTOOLSNOISERECORDERMAPBACKEND_HEADER_
+
+#include "noiserecorderbackend.h"
+#include "noiserecorder.h"
+
+#include <map>
+#include <memory>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class NoiseRecorderMapBackend
+     *
+     * @brief Noise recorder backend using a separate emulator
+     * NoiseRecorder instance per frequency.
+     */
+    class NoiseRecorderMapBackend : public NoiseRecorderBackend
+    {
+    public:
+      NoiseRecorderMapBackend(const Microseconds & binSize,
+                              const Microseconds & maxOffset,
+                              const Microseconds & maxPropagation,
+                              const Microseconds & maxDuration);
+
+      void addFrequency(std::uint64_t u64FrequencyHz,
+                        std::uint64_t u64BandwidthHz) override;
+
+      std::pair<TimePoint,TimePoint>
+      update(const TimePoint & now,
+             const TimePoint & txTime,
+             const Microseconds & offset,
+             const Microseconds & propagation,
+             const Microseconds & duration,
+             std::uint64_t u64FrequencyHz,
+             std::uint64_t u64BandwidthHz,
+             double dRxPowerMilliWatt,
+             const std::vector<NEMId> & transmitters,
+             std::uint64_t u64LowerOverlapFrequencyHz,
+             std::uint64_t u64UpperOverlapFrequencyHz,
+             AntennaIndex txAntennaIndex) override;
+
+      FrequencySet getFrequencies() const override;
+
+      SpectrumWindow get(const TimePoint & now,
+                         std::uint64_t u64FrequencyHz,
+                         const Microseconds & duration,
+                         const TimePoint & timepoint) const override;
+
+      std::vector<double> dump(std::uint64_t u64FrequencyHz) const override;
+
+      std::size_t getCommittedBytes(std::uint64_t u64FrequencyHz) const override;
+
+    private:
+      using NoiseRecorderMap = std::map<std::uint64_t,std::unique_ptr<NoiseRecorder>>;
+
+      Microseconds binSize_;
+      Microseconds maxOffset_;
+      Microseconds maxPropagation_;
+      Microseconds maxDuration_;
+      NoiseRecorderMap noiseRecorderMap_;
+
+      NoiseRecorderMap::iterator findOrInsert(std::uint64_t u64FrequencyHz,
+                                              std::uint64_t u64BandwidthHz);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSNOISERECORDERMAPBACKEND_HEADER_
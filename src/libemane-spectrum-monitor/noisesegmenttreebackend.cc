@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "noisesegmenttreebackend.h"
+
+#include "emane/utils/spectrumwindowutils.h"
+
+#include <algorithm>
+
+/**
+ * Lazy propagation segment tree supporting range add, range clear
+ * and range max over a fixed number of bins.
+ *
+ * Each node holds the max of its subtree along with a pending
+ * transform, x -> (clear ? 0 : x) + add, that has not yet been
+ * pushed to its children.
+ */
+class EMANE::SpectrumTools::NoiseSegmentTreeBackend::SegmentTree
+{
+public:
+  SegmentTree(std::size_t size, HugePageMode hugePageMode):
+    size_{size},
+    max_(4 * size,0,HugePageAllocator<double>{hugePageMode}),
+    add_(4 * size,0,HugePageAllocator<double>{hugePageMode}),
+    clear_(4 * size,0,HugePageAllocator<std::uint8_t>{hugePageMode}){}
+
+  std::size_t getCommittedBytes() const
+  {
+    return max_.capacity() * sizeof(double) +
+      add_.capacity() * sizeof(double) +
+      clear_.capacity() * sizeof(std::uint8_t);
+  }
+
+  void add(std::size_t first, std::size_t last, double dValue)
+  {
+    add(1,0,size_ - 1,first,last,dValue);
+  }
+
+  void clear(std::size_t first, std::size_t last)
+  {
+    clear(1,0,size_ - 1,first,last);
+  }
+
+  double max(std::size_t first, std::size_t last) const
+  {
+    return max(1,0,size_ - 1,first,last,Transform{});
+  }
+
+  void values(std::size_t first, std::size_t last, double * pValues) const
+  {
+    values(1,0,size_ - 1,first,last,Transform{},pValues);
+  }
+
+private:
+  struct Transform
+  {
+    bool bClear_;
+    double dAdd_;
+
+    Transform(bool bClear = false, double dAdd = 0):
+      bClear_{bClear},
+      dAdd_{dAdd}{}
+
+    double operator()(double dValue) const
+    {
+      return (bClear_ ? 0 : dValue) + dAdd_;
+    }
+
+    // compose this (outer) transform with a node's pending (inner) transform
+    Transform compose(bool bClear, double dAdd) const
+    {
+      return bClear_ ? *this : Transform{bClear,dAdd + dAdd_};
+    }
+  };
+
+  std::size_t size_;
+  std::vector<double,HugePageAllocator<double>> max_;
+  std::vector<double,HugePageAllocator<double>> add_;
+  std::vector<std::uint8_t,HugePageAllocator<std::uint8_t>> clear_;
+
+  void applyAdd(std::size_t node, double dValue)
+  {
+    max_[node] += dValue;
+    add_[node] += dValue;
+  }
+
+  void applyClear(std::size_t node)
+  {
+    max_[node] = 0;
+    add_[node] = 0;
+    clear_[node] = 1;
+  }
+
+  void push(std::size_t node)
+  {
+    if(clear_[node])
+      {
+        applyClear(2 * node);
+        applyClear(2 * node + 1);
+        clear_[node] = 0;
+      }
+
+    if(add_[node])
+      {
+        applyAdd(2 * node,add_[node]);
+        applyAdd(2 * node + 1,add_[node]);
+        add_[node] = 0;
+      }
+  }
+
+  void add(std::size_t node,
+           std::size_t low,
+           std::size_t high,
+           std::size_t first,
+           std::size_t last,
+           double dValue)
+  {
+    if(first <= low && high <= last)
+      {
+        applyAdd(node,dValue);
+        return;
+      }
+
+    push(node);
+
+    std::size_t mid{low + (high - low) / 2};
+
+    if(first <= mid)
+      {
+        add(2 * node,low,mid,first,last,dValue);
+      }
+
+    if(last > mid)
+      {
+        add(2 * node + 1,mid + 1,high,first,last,dValue);
+      }
+
+    max_[node] = std::max(max_[2 * node],max_[2 * node + 1]);
+  }
+
+  void clear(std::size_t node,
+             std::size_t low,
+             std::size_t high,
+             std::size_t first,
+             std::size_t last)
+  {
+    if(first <= low && high <= last)
+      {
+        applyClear(node);
+        return;
+      }
+
+    push(node);
+
+    std::size_t mid{low + (high - low) / 2};
+
+    if(first <= mid)
+      {
+        clear(2 * node,low,mid,first,last);
+      }
+
+    if(last > mid)
+      {
+        clear(2 * node + 1,mid + 1,high,first,last);
+      }
+
+    max_[node] = std::max(max_[2 * node],max_[2 * node + 1]);
+  }
+
+  double max(std::size_t node,
+             std::size_t low,
+             std::size_t high,
+             std::size_t first,
+             std::size_t last,
+             const Transform & transform) const
+  {
+    if(first <= low && high <= last)
+      {
+        return transform(max_[node]);
+      }
+
+    auto childTransform = transform.compose(clear_[node],add_[node]);
+
+    std::size_t mid{low + (high - low) / 2};
+
+    double dMax{};
+
+    if(first <= mid)
+      {
+        dMax = max(2 * node,low,mid,first,last,childTransform);
+      }
+
+    if(last > mid)
+      {
+        dMax = std::max(dMax,max(2 * node + 1,mid + 1,high,first,last,childTransform));
+      }
+
+    return dMax;
+  }
+
+  void values(std::size_t node,
+              std::size_t low,
+              std::size_t high,
+              std::size_t first,
+              std::size_t last,
+              const Transform & transform,
+              double * pValues) const
+  {
+    if(low == high)
+      {
+        pValues[low - first] = transform(max_[node]);
+        return;
+      }
+
+    auto childTransform = transform.compose(clear_[node],add_[node]);
+
+    std::size_t mid{low + (high - low) / 2};
+
+    if(first <= mid)
+      {
+        values(2 * node,low,mid,first,last,childTransform,pValues);
+      }
+
+    if(last > mid)
+      {
+        values(2 * node + 1,mid + 1,high,first,last,childTransform,pValues);
+      }
+  }
+};
+
+namespace
+{
+  // call fn for the one or two ring index ranges covering the
+  // absolute bin range [startBin,endBin]
+  template<typename Function>
+  void forEachRingRange(EMANE::Microseconds::rep startBin,
+                        EMANE::Microseconds::rep endBin,
+                        EMANE::Microseconds::rep totalRingBins,
+                        Function fn)
+  {
+    std::size_t first = startBin % totalRingBins;
+    std::size_t last = endBin % totalRingBins;
+
+    if(first <= last)
+      {
+        fn(first,last);
+      }
+    else
+      {
+        fn(first,totalRingBins - 1);
+        fn(0,last);
+      }
+  }
+}
+
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::NoiseSegmentTreeBackend(const Microseconds & binSize,
+                                                                       const Microseconds & maxOffset,
+                                                                       const Microseconds & maxPropagation,
+                                                                       const Microseconds & maxDuration,
+                                                                       HugePageMode hugePageMode):
+  binSize_{binSize},
+  totalWindowBins_{(maxOffset + maxPropagation + 2 * maxDuration) / binSize},
+  totalRingBins_{2 * totalWindowBins_ + 1},
+  horizonBin_{-1},
+  hugePageMode_{hugePageMode},
+  segmentTreeMap_{}{}
+
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::~NoiseSegmentTreeBackend(){}
+
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::SegmentTreeMap::iterator
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::findOrInsert(std::uint64_t u64FrequencyHz)
+{
+  auto iter = segmentTreeMap_.find(u64FrequencyHz);
+
+  if(iter == segmentTreeMap_.end())
+    {
+      iter = segmentTreeMap_.insert(std::make_pair(u64FrequencyHz,
+                                                   std::unique_ptr<SegmentTree>{new SegmentTree(totalRingBins_,hugePageMode_)})).first;
+    }
+
+  return iter;
+}
+
+void EMANE::SpectrumTools::NoiseSegmentTreeBackend::advance(Microseconds::rep horizonBin)
+{
+  if(horizonBin <= horizonBin_)
+    {
+      return;
+    }
+
+  // zero the ring bins being reused for the new bins
+  auto startBin = std::max(horizonBin_ + 1,horizonBin - totalRingBins_ + 1);
+
+  for(auto & entry : segmentTreeMap_)
+    {
+      auto & segmentTree = *entry.second;
+
+      forEachRingRange(startBin,
+                       horizonBin,
+                       totalRingBins_,
+                       [&segmentTree](std::size_t first, std::size_t last)
+                       {
+                         segmentTree.clear(first,last);
+                       });
+    }
+
+  horizonBin_ = horizonBin;
+}
+
+double EMANE::SpectrumTools::NoiseSegmentTreeBackend::max(const SegmentTree & segmentTree,
+                                                          Microseconds::rep startBin,
+                                                          Microseconds::rep endBin) const
+{
+  startBin = std::max(startBin,horizonBin_ - totalRingBins_ + 1);
+
+  endBin = std::min(endBin,horizonBin_);
+
+  double dMax{};
+
+  if(startBin <= endBin)
+    {
+      forEachRingRange(startBin,
+                       endBin,
+                       totalRingBins_,
+                       [&segmentTree,&dMax](std::size_t first, std::size_t last)
+                       {
+                         dMax = std::max(dMax,segmentTree.max(first,last));
+                       });
+    }
+
+  return dMax;
+}
+
+std::vector<double>
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::values(const SegmentTree & segmentTree,
+                                                      Microseconds::rep startBin,
+                                                      Microseconds::rep endBin) const
+{
+  std::vector<double> energies(endBin - startBin + 1,0);
+
+  // only bins within the ring hold valid energy
+  auto validStartBin = std::max(startBin,horizonBin_ - totalRingBins_ + 1);
+
+  auto validEndBin = std::min(endBin,horizonBin_);
+
+  if(validStartBin <= validEndBin)
+    {
+      double * pEnergies = &energies[validStartBin - startBin];
+
+      forEachRingRange(validStartBin,
+                       validEndBin,
+                       totalRingBins_,
+                       [&segmentTree,&pEnergies](std::size_t first, std::size_t last)
+                       {
+                         segmentTree.values(first,last,pEnergies);
+                         pEnergies += last - first + 1;
+                       });
+    }
+
+  return energies;
+}
+
+void EMANE::SpectrumTools::NoiseSegmentTreeBackend::addFrequency(std::uint64_t u64FrequencyHz,
+                                                                 std::uint64_t)
+{
+  findOrInsert(u64FrequencyHz);
+}
+
+std::pair<EMANE::TimePoint,EMANE::TimePoint>
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::update(const TimePoint & now,
+                                                      const TimePoint & txTime,
+                                                      const Microseconds & offset,
+                                                      const Microseconds & propagation,
+                                                      const Microseconds & duration,
+                                                      std::uint64_t u64FrequencyHz,
+                                                      std::uint64_t,
+                                                      double dRxPowerMilliWatt,
+                                                      const std::vector<NEMId> &,
+                                                      std::uint64_t,
+                                                      std::uint64_t,
+                                                      AntennaIndex)
+{
+  auto & segmentTree = *findOrInsert(u64FrequencyHz)->second;
+
+  auto nowBin = Utils::timepointToAbsoluteBin(now,binSize_,false);
+
+  advance(nowBin + totalWindowBins_);
+
+  auto startOfReception = txTime + offset + propagation;
+
+  auto endOfReception = startOfReception + duration;
+
+  auto startOfReceptionBin = Utils::timepointToAbsoluteBin(startOfReception,binSize_,false);
+
+  auto endOfReceptionBin = std::max(startOfReceptionBin,
+                                    Utils::timepointToAbsoluteBin(endOfReception,binSize_,true));
+
+  // reception ended before the start of the noise window
+  if(endOfReceptionBin <= nowBin - totalWindowBins_)
+    {
+      return std::make_pair(startOfReception,endOfReception);
+    }
+
+  startOfReceptionBin = std::max(startOfReceptionBin,nowBin - totalWindowBins_ + 1);
+
+  endOfReceptionBin = std::min(endOfReceptionBin,horizonBin_);
+
+  if(startOfReceptionBin <= endOfReceptionBin)
+    {
+      forEachRingRange(startOfReceptionBin,
+                       endOfReceptionBin,
+                       totalRingBins_,
+                       [&segmentTree,dRxPowerMilliWatt](std::size_t first, std::size_t last)
+                       {
+                         segmentTree.add(first,last,dRxPowerMilliWatt);
+                       });
+    }
+
+  return std::make_pair(startOfReception,endOfReception);
+}
+
+EMANE::FrequencySet
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::getFrequencies() const
+{
+  FrequencySet frequencySet;
+
+  for(auto & entry : segmentTreeMap_)
+    {
+      frequencySet.insert(entry.first);
+    }
+
+  return frequencySet;
+}
+
+EMANE::SpectrumWindow
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::get(const TimePoint & now,
+                                                   std::uint64_t u64FrequencyHz,
+                                                   const Microseconds & duration,
+                                                   const TimePoint & timepoint) const
+{
+  const auto iter = segmentTreeMap_.find(u64FrequencyHz);
+
+  if(iter == segmentTreeMap_.end())
+    {
+      return SpectrumWindow{{},{},{},{},false};
+    }
+
+  auto nowBin = Utils::timepointToAbsoluteBin(now,binSize_,false);
+
+  Microseconds::rep startBin{};
+  Microseconds::rep endBin{};
+
+  if(timepoint == TimePoint::min())
+    {
+      endBin = nowBin;
+
+      startBin = duration == Microseconds::zero() ?
+        nowBin - totalWindowBins_ + 1 :
+        Utils::timepointToAbsoluteBin(now - duration,binSize_,false);
+    }
+  else
+    {
+      startBin = Utils::timepointToAbsoluteBin(timepoint,binSize_,false);
+
+      endBin = duration == Microseconds::zero() ?
+        nowBin :
+        Utils::timepointToAbsoluteBin(timepoint + duration,binSize_,true);
+    }
+
+  startBin = std::max(startBin,nowBin - totalWindowBins_ + 1);
+
+  endBin = std::min(std::max(startBin,endBin),startBin + totalRingBins_ - 1);
+
+  return SpectrumWindow{values(*iter->second,startBin,endBin),
+      TimePoint{Microseconds{startBin * binSize_.count()}},
+      binSize_,
+      0,
+      true};
+}
+
+std::vector<double>
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::dump(std::uint64_t u64FrequencyHz) const
+{
+  const auto iter = segmentTreeMap_.find(u64FrequencyHz);
+
+  if(iter == segmentTreeMap_.end())
+    {
+      return {};
+    }
+
+  return values(*iter->second,horizonBin_ - totalRingBins_ + 1,horizonBin_);
+}
+
+std::size_t
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::getCommittedBytes(std::uint64_t u64FrequencyHz) const
+{
+  auto iter = segmentTreeMap_.find(u64FrequencyHz);
+
+  return iter != segmentTreeMap_.end() ? iter->second->getCommittedBytes() : 0;
+}
+
+EMANE::SpectrumTools::NoiseRecorderBackend::EnergySummary
+EMANE::SpectrumTools::NoiseSegmentTreeBackend::maxSummary(const TimePoint &,
+                                                          const TimePoint & startTime,
+                                                          const Microseconds & summaryBinSize,
+                                                          std::size_t summaryBinCount) const
+{
+  EnergySummary summary{};
+
+  summary.reserve(segmentTreeMap_.size());
+
+  for(const auto & entry : segmentTreeMap_)
+    {
+      std::vector<double> energies(summaryBinCount);
+
+      for(std::size_t i = 0; i < summaryBinCount; ++i)
+        {
+          energies[i] =
+            max(*entry.second,
+                Utils::timepointToAbsoluteBin(startTime + summaryBinSize * i,
+                                              binSize_,
+                                              false),
+                Utils::timepointToAbsoluteBin(startTime + summaryBinSize * (i + 1) - Microseconds{1},
+                                              binSize_,
+                                              true));
+        }
+
+      summary.emplace_back(entry.first,std::move(energies));
+    }
+
+  return summary;
+}
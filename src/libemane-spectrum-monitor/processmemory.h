@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSPROCESSMEMORY_HEADER_
+#define EMANESPECTRUMTOOLSPROCESSMEMORY_HEADER_
+
+#include <fstream>
+#include <string>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    // resident, locked and peak resident memory from /proc/self/status
+    inline std::string processMemoryStatus()
+    {
+      std::ifstream status{"/proc/self/status"};
+
+      std::string sLine{};
+
+      std::string sStatus{};
+
+      while(std::getline(status,sLine))
+        {
+          if(!sLine.compare(0,6,"VmRSS:") ||
+             !sLine.compare(0,6,"VmLck:") ||
+             !sLine.compare(0,6,"VmHWM:"))
+            {
+              if(!sStatus.empty())
+                {
+                  sStatus += ", ";
+                }
+
+              // collapse the column padding
+              auto pos = sLine.find_first_not_of(" \t",sLine.find(':') + 1);
+
+              sStatus += sLine.substr(0,sLine.find(':') + 1) + " " + sLine.substr(pos);
+            }
+        }
+
+      return sStatus;
+    }
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSPROCESSMEMORY_HEADER_
@@ -39,6 +39,9 @@
 #include "fadingmanager.h"
 #include "spectrummonitoralt.h"
 #include "antennamanager.h"
+#include "nakagamivariatepool.h"
+#include "gaingridmanager.h"
+#include "latencyhistogramtable.h"
 
 #include "emane/commonphyheader.h"
 #include "emane/controls/antennareceiveinfo.h"
@@ -47,18 +50,13 @@ namespace EMANE
 {
   namespace SpectrumTools
   {
+    // ReceiveProcessorAlt implementations are specialized at compile
+    // time on propagation model and fading policy, see
+    // receiveprocessoraltimpl.h. Use selectFactory() once at configure
+    // time to pick the specialization matching the configuration.
     class ReceiveProcessorAlt
     {
     public:
-      ReceiveProcessorAlt(NEMId id,
-                          std::uint16_t u16SubId,
-                          AntennaIndex rxAntennaIndex,
-                          AntennaManager & antennaManager,
-                          SpectrumMonitorAlt * pSpectrumMonitorAlt,
-                          PropagationModelAlgorithm * pPropagationModelAlgorithm,
-                          FadingAlgorithmStore && fadingAlgorithmStore,
-                          bool bPopulateReceivePowerMap);
-
       struct ProcessResult
       {
         enum class Status
@@ -76,6 +74,7 @@ namespace EMANE
             DROP_CODE_SPECTRUM_CLAMP,
             DROP_CODE_NOT_FOI,
             DROP_CODE_OUT_OF_BAND,
+            DROP_CODE_NO_TX_ANTENNAS,
             SUCCESS
           };
 
@@ -84,6 +83,8 @@ namespace EMANE
         Microseconds mimoPropagationDelay_{};
         Controls::AntennaReceiveInfos antennaReceiveInfos_{};
         bool bGainCacheHit_{};
+        bool bGainCacheLookup_{};
+        std::uint8_t u8SpectrumViolations_{}; // SpectrumMonitorAlt::UpdateResult::Violation
         std::map<std::tuple<NEMId, // src
                             AntennaIndex, // rx antena
                             AntennaIndex, // tx antenna
@@ -103,25 +104,43 @@ namespace EMANE
           mimoPropagationDelay_{std::move(rhs.mimoPropagationDelay_)},
           antennaReceiveInfos_{std::move(rhs.antennaReceiveInfos_)},
           bGainCacheHit_{rhs.bGainCacheHit_},
+          bGainCacheLookup_{rhs.bGainCacheLookup_},
+          u8SpectrumViolations_{rhs.u8SpectrumViolations_},
           receivePowerMap_{std::move(rhs.receivePowerMap_)}{}
 
       };
 
-      ProcessResult process(const TimePoint & now,
-                            const CommonPHYHeader & commonPHYHeader,
-                            const std::vector<std::pair<LocationInfo,bool>> & locationInfos,
-                            const  std::vector<std::pair<FadingInfo,bool>> & fadingSelection);
-
-    private:
-      NEMId id_;
-      std::uint16_t u16SubId_;
-      AntennaIndex rxAntennaIndex_;
-      GainManager gainManager_;
-      SpectrumMonitorAlt * pSpectrumMonitorAlt_;
-      PropagationModelAlgorithm * pPropagationModelAlgorithm_;
-      FadingAlgorithmStore fadingAlgorithmStore_;
-      bool bPopulateReceivePowerMap_;
-      std::uint64_t u64SpectrumMonitorUpdateSequence_;
+      using Factory = ReceiveProcessorAlt * (*)(NEMId id,
+                                                std::uint16_t u16SubId,
+                                                AntennaIndex rxAntennaIndex,
+                                                GainManager & gainManager,
+                                                GainGridManager * pGainGridManager,
+                                                SpectrumMonitorAlt * pSpectrumMonitorAlt,
+                                                PropagationModelAlgorithm * pPropagationModelAlgorithm,
+                                                FadingAlgorithmStore && fadingAlgorithmStore,
+                                                NakagamiVariatePool * pNakagamiVariatePool,
+                                                LatencyHistogramTable * pLatencyHistogramTable,
+                                                bool bPopulateReceivePowerMap);
+
+      virtual ~ReceiveProcessorAlt(){}
+
+      virtual ProcessResult process(const TimePoint & now,
+                                    const CommonPHYHeader & commonPHYHeader,
+                                    const std::vector<std::pair<LocationInfo,bool>> & locationInfos,
+                                    const std::vector<std::pair<FadingInfo,bool>> & fadingSelection) = 0;
+
+      // bytes held by the processor and its per segment scratch
+      virtual std::size_t getCommittedBytes() const = 0;
+
+      // selects the specialization for the concrete type of
+      // pPropagationModelAlgorithm, falling back to virtual dispatch
+      // for unknown types. bNakagamiFading selects a fading policy
+      // that calls the nakagami algorithm directly.
+      static Factory selectFactory(const PropagationModelAlgorithm * pPropagationModelAlgorithm,
+                                   bool bNakagamiFading);
+
+    protected:
+      ReceiveProcessorAlt() = default;
     };
   }
 }
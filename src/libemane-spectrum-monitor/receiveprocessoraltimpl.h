@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSRECEIVEPROCESSORALTIMPL_HEADER_
+#define EMANESPECTRUMTOOLSRECEIVEPROCESSORALTIMPL_HEADER_
+
+#include "receiveprocessoralt.h"
+#include "nakagamivariatepool.h"
+#include "nakagamifadingalgorithm.h"
+#include "traceprobes.h"
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    // fading policy using a fading algorithm store lookup and a
+    // virtual call per segment
+    class GenericFadingPolicy
+    {
+    public:
+      explicit GenericFadingPolicy(FadingAlgorithmStore & fadingAlgorithmStore);
+
+      GenericFadingPolicy(FadingAlgorithmStore & fadingAlgorithmStore,
+                          NakagamiVariatePool * pNakagamiVariatePool);
+
+      // fades count segment powers, returns false if the fading
+      // model has no algorithm
+      bool apply(const FadingInfo & fadingInfo,
+                 const double * pPowerdBm,
+                 double * pRxPowerMilliWatt,
+                 std::size_t count,
+                 double dDistanceMeters);
+
+    private:
+      FadingAlgorithmStore & fadingAlgorithmStore_;
+    };
+
+    // fading policy caching the nakagami algorithm and calling it
+    // without virtual dispatch, all other models use the generic
+    // policy. When a variate pool is present, all segments are faded
+    // in one batch using pre-generated variates.
+    class NakagamiFadingPolicy
+    {
+    public:
+      NakagamiFadingPolicy(FadingAlgorithmStore & fadingAlgorithmStore,
+                           NakagamiVariatePool * pNakagamiVariatePool);
+
+      bool apply(const FadingInfo & fadingInfo,
+                 const double * pPowerdBm,
+                 double * pRxPowerMilliWatt,
+                 std::size_t count,
+                 double dDistanceMeters);
+
+    private:
+      GenericFadingPolicy genericFadingPolicy_;
+      NakagamiFadingAlgorithm * pNakagamiFadingAlgorithm_;
+      NakagamiVariatePool * pNakagamiVariatePool_;
+    };
+
+    // qualified call to the concrete propagation model, allowing
+    // the compiler to inline the pathloss calculation
+    template<typename PropagationModel>
+    std::pair<std::vector<double>,bool>
+    propagationPathloss(PropagationModel * pPropagationModel,
+                        NEMId transmitterId,
+                        const LocationInfo & locationInfo,
+                        const FrequencySegments & segments)
+    {
+      return pPropagationModel->PropagationModel::operator()(transmitterId,
+                                                             locationInfo,
+                                                             segments);
+    }
+
+    // virtual dispatch fallback
+    inline std::pair<std::vector<double>,bool>
+    propagationPathloss(PropagationModelAlgorithm * pPropagationModelAlgorithm,
+                        NEMId transmitterId,
+                        const LocationInfo & locationInfo,
+                        const FrequencySegments & segments)
+    {
+      return (*pPropagationModelAlgorithm)(transmitterId,
+                                           locationInfo,
+                                           segments);
+    }
+
+    // PropagationModel is the concrete PropagationModelAlgorithm
+    // type, called without virtual dispatch so the pathloss
+    // calculation can be inlined. PropagationModelAlgorithm itself
+    // may be used to fall back to virtual dispatch.
+    template<typename PropagationModel, typename FadingPolicy>
+    class ReceiveProcessorAltImpl : public ReceiveProcessorAlt
+    {
+    public:
+      ReceiveProcessorAltImpl(NEMId id,
+                              std::uint16_t u16SubId,
+                              AntennaIndex rxAntennaIndex,
+                              GainManager & gainManager,
+                              GainGridManager * pGainGridManager,
+                              SpectrumMonitorAlt * pSpectrumMonitorAlt,
+                              PropagationModel * pPropagationModel,
+                              FadingAlgorithmStore && fadingAlgorithmStore,
+                              NakagamiVariatePool * pNakagamiVariatePool,
+                              LatencyHistogramTable * pLatencyHistogramTable,
+                              bool bPopulateReceivePowerMap);
+
+      ProcessResult process(const TimePoint & now,
+                            const CommonPHYHeader & commonPHYHeader,
+                            const std::vector<std::pair<LocationInfo,bool>> & locationInfos,
+                            const std::vector<std::pair<FadingInfo,bool>> & fadingSelection) override;
+
+      std::size_t getCommittedBytes() const override;
+
+      static ReceiveProcessorAlt * create(NEMId id,
+                                          std::uint16_t u16SubId,
+                                          AntennaIndex rxAntennaIndex,
+                                          GainManager & gainManager,
+                                          GainGridManager * pGainGridManager,
+                                          SpectrumMonitorAlt * pSpectrumMonitorAlt,
+                                          PropagationModelAlgorithm * pPropagationModelAlgorithm,
+                                          FadingAlgorithmStore && fadingAlgorithmStore,
+                                          NakagamiVariatePool * pNakagamiVariatePool,
+                                          LatencyHistogramTable * pLatencyHistogramTable,
+                                          bool bPopulateReceivePowerMap);
+
+    private:
+      NEMId id_;
+      std::uint16_t u16SubId_;
+      AntennaIndex rxAntennaIndex_;
+      GainManager & gainManager_;
+      GainGridManager * pGainGridManager_;
+      SpectrumMonitorAlt * pSpectrumMonitorAlt_;
+      PropagationModel * pPropagationModel_;
+      FadingAlgorithmStore fadingAlgorithmStore_;
+      FadingPolicy fadingPolicy_;
+      LatencyHistogramTable * pLatencyHistogramTable_;
+      bool bPopulateReceivePowerMap_;
+      std::uint64_t u64SpectrumMonitorUpdateSequence_;
+
+      // per segment scratch reused across packets
+      std::vector<double> txPowersdBm_;
+      std::vector<double> powersdBm_;
+      std::vector<double> rxPowersMilliWatt_;
+    };
+  }
+}
+
+#include "receiveprocessoraltimpl.inl"
+
+#endif //EMANESPECTRUMTOOLSRECEIVEPROCESSORALTIMPL_HEADER_
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+template<typename PropagationModel, typename FadingPolicy>
+EMANE::SpectrumTools::ReceiveProcessorAltImpl<PropagationModel,FadingPolicy>::ReceiveProcessorAltImpl(NEMId id,
+                                                                                                       std::uint16_t u16SubId,
+                                                                                                       AntennaIndex rxAntennaIndex,
+                                                                                                       GainManager & gainManager,
+                                                                                                       GainGridManager * pGainGridManager,
+                                                                                                       SpectrumMonitorAlt * pSpectrumMonitorAlt,
+                                                                                                       PropagationModel * pPropagationModel,
+                                                                                                       FadingAlgorithmStore && fadingAlgorithmStore,
+                                                                                                       NakagamiVariatePool * pNakagamiVariatePool,
+                                                                                                       LatencyHistogramTable * pLatencyHistogramTable,
+                                                                                                       bool bPopulateReceivePowerMap):
+  id_{id},
+  u16SubId_{u16SubId},
+  rxAntennaIndex_{rxAntennaIndex},
+  gainManager_(gainManager),
+  pGainGridManager_{pGainGridManager},
+  pSpectrumMonitorAlt_{pSpectrumMonitorAlt},
+  pPropagationModel_{pPropagationModel},
+  fadingAlgorithmStore_{std::move(fadingAlgorithmStore)},
+  fadingPolicy_{fadingAlgorithmStore_,pNakagamiVariatePool},
+  pLatencyHistogramTable_{pLatencyHistogramTable},
+  bPopulateReceivePowerMap_{bPopulateReceivePowerMap},
+  u64SpectrumMonitorUpdateSequence_{},
+  txPowersdBm_{},
+  powersdBm_{},
+  rxPowersMilliWatt_{}{}
+
+template<typename PropagationModel, typename FadingPolicy>
+EMANE::SpectrumTools::ReceiveProcessorAlt *
+EMANE::SpectrumTools::ReceiveProcessorAltImpl<PropagationModel,FadingPolicy>::create(NEMId id,
+                                                                                      std::uint16_t u16SubId,
+                                                                                      AntennaIndex rxAntennaIndex,
+                                                                                      GainManager & gainManager,
+                                                                                      GainGridManager * pGainGridManager,
+                                                                                      SpectrumMonitorAlt * pSpectrumMonitorAlt,
+                                                                                      PropagationModelAlgorithm * pPropagationModelAlgorithm,
+                                                                                      FadingAlgorithmStore && fadingAlgorithmStore,
+                                                                                      NakagamiVariatePool * pNakagamiVariatePool,
+                                                                                      LatencyHistogramTable * pLatencyHistogramTable,
+                                                                                      bool bPopulateReceivePowerMap)
+{
+  // selectFactory() has verified the concrete type
+  return new ReceiveProcessorAltImpl{id,
+                                     u16SubId,
+                                     rxAntennaIndex,
+                                     gainManager,
+                                     pGainGridManager,
+                                     pSpectrumMonitorAlt,
+                                     static_cast<PropagationModel *>(pPropagationModelAlgorithm),
+                                     std::move(fadingAlgorithmStore),
+                                     pNakagamiVariatePool,
+                                     pLatencyHistogramTable,
+                                     bPopulateReceivePowerMap};
+}
+
+
+template<typename PropagationModel, typename FadingPolicy>
+EMANE::SpectrumTools::ReceiveProcessorAlt::ProcessResult
+EMANE::SpectrumTools::ReceiveProcessorAltImpl<PropagationModel,FadingPolicy>::process(const TimePoint & now,
+                                                                                       const CommonPHYHeader & commonPHYHeader,
+                                                                                       const std::vector<std::pair<LocationInfo,bool>> & locationInfos,
+                                                                                       const std::vector<std::pair<FadingInfo,bool>> & fadingInfos)
+{
+  ProcessResult result{};
+
+  // stage timestamps, only taken when latency histograms are enabled
+  LatencyHistogramTable::StageTimer stageTimer{pLatencyHistogramTable_};
+
+  const auto & frequencyGroups =
+    commonPHYHeader.getFrequencyGroups();
+
+  ++u64SpectrumMonitorUpdateSequence_;
+
+  for(const auto & transmitAntenna : commonPHYHeader.getTransmitAntennas())
+    {
+      auto groupIndex = transmitAntenna.getFrequencyGroupIndex();
+
+      if(groupIndex > frequencyGroups.size())
+        {
+          result.status_ = ProcessResult::Status::DROP_CODE_ANTENNA_FREQ_INDEX;
+
+          //drop
+          return result;
+        }
+
+      const auto & frequencySegments = frequencyGroups[groupIndex];
+
+      std::vector<double> rxPowerSegmentsMilliWatt(frequencySegments.size(),0);
+
+      Microseconds propagation{};
+
+      bool bHavePropagationDelay{};
+
+      std::vector<NEMId> transmitters{};
+
+      int iTransmitterIndex{};
+
+      for(const auto & transmitter : commonPHYHeader.getTransmitters())
+        {
+          transmitters.push_back(transmitter.getNEMId());
+          // get the location info for a pair of nodes
+          const auto & locationInfo = locationInfos[iTransmitterIndex];
+          const auto & fadingInfo = fadingInfos[iTransmitterIndex];
+          ++iTransmitterIndex;
+
+          stageTimer.restart();
+
+          //locationManager_.getLocationInfo(transmitter.getNEMId());
+
+          // get the propagation model pathloss between a pair of nodes for *each* segment
+          auto pathlossInfo = propagationPathloss(pPropagationModel_,
+                                                  transmitter.getNEMId(),
+                                                  locationInfo.first,
+                                                  frequencySegments);
+
+          stageTimer.mark(LatencyHistogramTable::STAGE_PATHLOSS);
+
+          // if pathloss is available
+          if(pathlossInfo.second)
+            {
+              // calculate the combined gain (Tx + Rx antenna gain) dBi
+              // note: gain manager accesses antenna profiles, knows self node profile info
+              //       if available, and is updated with all nodes profile info
+              GainGridManager::GainInfo gainInfodBi{};
+
+              if(pGainGridManager_)
+                {
+                  gainInfodBi = pGainGridManager_->determineGain(transmitter.getNEMId(),
+                                                                 transmitAntenna.getIndex(),
+                                                                 locationInfo);
+                }
+              else
+                {
+                  gainInfodBi = std::tuple_cat(gainManager_.determineGain(transmitter.getNEMId(),
+                                                                          transmitAntenna.getIndex(),
+                                                                          locationInfo.first),
+                                               std::make_tuple(true));
+                }
+
+              stageTimer.mark(LatencyHistogramTable::STAGE_GAIN);
+
+              // if gain is available
+              if(std::get<2>(gainInfodBi) == EMANE::GainManager::GainStatus::SUCCESS)
+                {
+                  result.bGainCacheHit_ = std::get<3>(gainInfodBi);
+
+                  // grid lookups never consult the gain cache
+                  result.bGainCacheLookup_ = std::get<4>(gainInfodBi);
+
+                  //using ReceivePowerPubisherUpdate = std::tuple<NEMId,std::uint64_t,double>;
+
+                  // set to prevent multiple ReceivePowerTablePublisher updates
+                  // for the same NEM frequency pair in a frequency segment list
+                  //std::set<ReceivePowerPubisherUpdate> receivePowerTableUpdate{};
+
+                  // frequency segment iterator to map pathloss per segment to
+                  // the associated segment
+                  FrequencySegments::const_iterator freqIter{frequencySegments.begin()};
+
+                  const auto & pathlossesdB = pathlossInfo.first;
+
+                  const std::size_t segmentCount{pathlossesdB.size()};
+
+                  txPowersdBm_.resize(segmentCount);
+                  powersdBm_.resize(segmentCount);
+                  rxPowersMilliWatt_.resize(segmentCount);
+
+                  // link budget for each segment
+                  for(std::size_t i = 0; i < segmentCount; ++i)
+                    {
+                      auto optionalSegmentPowerdBm = freqIter->getPowerdBm();
+
+                      txPowersdBm_[i] = optionalSegmentPowerdBm.second ?
+                        optionalSegmentPowerdBm.first :
+                        transmitter.getPowerdBm();
+
+                      powersdBm_[i] = txPowersdBm_[i] +
+                        std::get<0>(gainInfodBi)  +
+                        std::get<1>(gainInfodBi) -
+                        pathlossesdB[i];
+
+                      ++freqIter;
+                    }
+
+                  // fade all segments in a single batch
+                  if(segmentCount)
+                    {
+                      if(fadingInfo.second)
+                        {
+                          if(fadingInfo.first.first == Events::FadingModel::NONE)
+                            {
+                              for(std::size_t i = 0; i < segmentCount; ++i)
+                                {
+                                  rxPowersMilliWatt_[i] = Utils::DB_TO_MILLIWATT(powersdBm_[i]);
+                                }
+                            }
+                          else
+                            {
+                              if(locationInfo.second)
+                                {
+                                  //fading algorithms return mW
+                                  if(!fadingPolicy_.apply(fadingInfo.first,
+                                                          powersdBm_.data(),
+                                                          rxPowersMilliWatt_.data(),
+                                                          segmentCount,
+                                                          locationInfo.first.getDistanceMeters()))
+                                    {
+                                      result.status_ = ProcessResult::Status::DROP_CODE_FADINGMANAGER_ALGORITHM;
+
+                                      //drop
+                                      return result;
+                                    }
+                                }
+                              else
+                                {
+                                  result.status_ = ProcessResult::Status::DROP_CODE_FADINGMANAGER_LOCATION;
+
+                                  //drop
+                                  return result;
+                                }
+                            }
+                        }
+                      else
+                        {
+                          result.status_ = ProcessResult::Status::DROP_CODE_FADINGMANAGER_SELECTION;
+
+                          //drop
+                          return result;
+                        }
+                    }
+
+                  stageTimer.mark(LatencyHistogramTable::STAGE_FADING);
+
+                  freqIter = frequencySegments.begin();
+
+                  // sum up the rx power for each segment
+                  for(std::size_t i = 0; i < segmentCount; ++i)
+                    {
+                      rxPowerSegmentsMilliWatt[i] += rxPowersMilliWatt_[i];
+
+                      if(bPopulateReceivePowerMap_)
+                        {
+                          result.receivePowerMap_[std::make_tuple(transmitter.getNEMId(),
+                                                                  rxAntennaIndex_,
+                                                                  transmitAntenna.getIndex(),
+                                                                  freqIter->getFrequencyHz())] =std::make_tuple(Utils::MILLIWATT_TO_DB(rxPowersMilliWatt_[i]),
+                                                                                                                std::get<0>(gainInfodBi),
+                                                                                                                std::get<1>(gainInfodBi),
+                                                                                                                txPowersdBm_[i],
+                                                                                                                pathlossesdB[i]);
+                        }
+
+                      ++freqIter;
+                    }
+
+                  // calculate propagation delay from 1 of the transmitters
+                  //  note: these are collaborative (constructive) transmissions, all
+                  //        the messages are arriving at or near the same time. Destructive
+                  //        transmission should be sent as multiple messages
+                  if(locationInfo.second && !bHavePropagationDelay)
+                    {
+                      if(locationInfo.first.getDistanceMeters() > 0.0)
+                        {
+                          propagation =
+                            Microseconds{static_cast<std::uint64_t>(std::round(locationInfo.first.getDistanceMeters() / SOL_MPS * 1000000))};
+                        }
+
+                      bHavePropagationDelay = true;
+                    }
+                }
+              else
+                {
+                  // drop due to GainManager not enough info
+                  switch(std::get<2>(gainInfodBi))
+                    {
+                    case GainManager::GainStatus::ERROR_LOCATIONINFO:
+                      result.status_ = ProcessResult::Status::DROP_CODE_GAINMANAGER_LOCATION;
+                      break;
+                    case GainManager::GainStatus::ERROR_PROFILEINFO:
+                      result.status_ = ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNAPROFILE;
+                      break;
+                    case GainManager::GainStatus::ERROR_HORIZON:
+                      result.status_ = ProcessResult::Status::DROP_CODE_GAINMANAGER_HORIZON;
+                      break;
+                    case GainManager::GainStatus::ERROR_ANTENNA_INDEX:
+                      result.status_ = ProcessResult::Status::DROP_CODE_GAINMANAGER_ANTENNA_INDEX;
+                      break;
+                    default:
+                      break;
+                    }
+
+                  // drop
+                  return result;
+                }
+            }
+          else
+            {
+              // drop due to PropagationModelAlgorithm not enough info
+              result.status_ = ProcessResult::Status::DROP_CODE_PROPAGATIONMODEL;
+
+              // drop
+              return result;
+            }
+        }
+
+
+      // update the spectrum monitor with the signal information
+      // note: spectrum monitor will remove any frequency segments that are
+      //       below the receiver sensitivity. Any frequency segment not in
+      //       the foi will cause the entire message to be treated as out-of-band
+      //       regardless of the subid. Spectrum monitor will adjust SoT, propagation
+      //       delay, offset and duration if out of acceptable value range.
+      stageTimer.restart();
+
+      auto updateResult = pSpectrumMonitorAlt_->update(now,
+                                                        commonPHYHeader.getTxTime(),
+                                                        propagation,
+                                                        frequencySegments,
+                                                        transmitAntenna.getBandwidthHz(),
+                                                        rxPowerSegmentsMilliWatt,
+                                                        transmitters,
+                                                        transmitAntenna.getIndex(),
+                                                        transmitAntenna.getSpectralMaskIndex());
+
+      stageTimer.mark(LatencyHistogramTable::STAGE_SPECTRUM_UPDATE);
+
+      EMANE_SPECTRUM_TOOLS_PROBE4(spectrum_update,
+                                  commonPHYHeader.getSubId(),
+                                  frequencySegments.size(),
+                                  updateResult.bSuccess_,
+                                  updateResult.u8Violations_);
+
+      result.u8SpectrumViolations_ |= updateResult.u8Violations_;
+
+      if(!updateResult.bSuccess_)
+        {
+          result.status_ = ProcessResult::Status::DROP_CODE_SPECTRUM_CLAMP;
+
+          // drop
+          return result;
+        }
+    }
+
+  // below receiver sensitivity is still considered a success at this
+  // point since multiple antennas may be in use
+  result.status_ = ProcessResult::Status::SUCCESS;
+
+  return result;
+}
+
+template<typename PropagationModel, typename FadingPolicy>
+std::size_t
+EMANE::SpectrumTools::ReceiveProcessorAltImpl<PropagationModel,FadingPolicy>::getCommittedBytes() const
+{
+  return sizeof(*this) +
+    (txPowersdBm_.capacity() +
+     powersdBm_.capacity() +
+     rxPowersMilliWatt_.capacity()) * sizeof(double);
+}
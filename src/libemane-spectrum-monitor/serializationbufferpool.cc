@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "serializationbufferpool.h"
+
+EMANE::SpectrumTools::SerializationBufferPool::SerializationBufferPool(std::size_t maxIdleBuffers):
+  pStorage_{std::make_shared<Storage>()}
+{
+  pStorage_->maxIdleBuffers_ = maxIdleBuffers;
+}
+
+EMANE::SpectrumTools::SerializationBufferPool::Buffer *
+EMANE::SpectrumTools::SerializationBufferPool::acquire(std::size_t bytes)
+{
+  std::unique_ptr<Buffer> pBuffer{};
+
+  {
+    std::lock_guard<std::mutex> m(pStorage_->mutex_);
+
+    if(!pStorage_->idle_.empty())
+      {
+        pBuffer = std::move(pStorage_->idle_.back());
+
+        pStorage_->idle_.pop_back();
+      }
+  }
+
+  if(!pBuffer)
+    {
+      pBuffer.reset(new Buffer{});
+    }
+
+  pBuffer->data_.resize(bytes);
+
+  pBuffer->pStorage_ = pStorage_;
+
+  return pBuffer.release();
+}
+
+void EMANE::SpectrumTools::SerializationBufferPool::release(void *, void * pHint)
+{
+  std::unique_ptr<Buffer> pBuffer{static_cast<Buffer *>(pHint)};
+
+  // idle buffers do not reference the storage, the last outstanding
+  // buffer released after the pool is gone destroys it
+  std::shared_ptr<Storage> pStorage{std::move(pBuffer->pStorage_)};
+
+  std::lock_guard<std::mutex> m(pStorage->mutex_);
+
+  if(pStorage->idle_.size() < pStorage->maxIdleBuffers_)
+    {
+      pStorage->idle_.push_back(std::move(pBuffer));
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSERIALIZATIONBUFFERPOOL_HEADER_
+#define EMANESPECTRUMTOOLSSERIALIZATIONBUFFERPOOL_HEADER_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class SerializationBufferPool
+     *
+     * @brief Pool of serialization buffers handed to zmq_msg_init_data
+     * for zero-copy sends.
+     *
+     * ZMQ calls release() from its I/O thread once a message has been
+     * sent, returning the buffer to the pool with its capacity intact.
+     * Outstanding buffers keep the pool storage alive, so the pool may
+     * be destroyed while ZMQ still holds messages.
+     */
+    class SerializationBufferPool
+    {
+      struct Storage;
+
+    public:
+      struct Buffer
+      {
+        std::vector<std::uint8_t> data_{};
+        std::shared_ptr<Storage> pStorage_{};
+      };
+
+      explicit SerializationBufferPool(std::size_t maxIdleBuffers = 8);
+
+      /**
+       * Gets a buffer sized to bytes, reusing an idle buffer when one
+       * is available
+       */
+      Buffer * acquire(std::size_t bytes);
+
+      // zmq_free_fn compatible, pHint is the Buffer
+      static void release(void * pData, void * pHint);
+
+    private:
+      struct Storage
+      {
+        std::mutex mutex_{};
+        std::vector<std::unique_ptr<Buffer>> idle_{};
+        std::size_t maxIdleBuffers_{};
+      };
+
+      std::shared_ptr<Storage> pStorage_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSERIALIZATIONBUFFERPOOL_HEADER_
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "spectrumenergycompressor.h"
+
+#include <stdexcept>
+
+#include <time.h>
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace
+{
+  std::uint64_t threadCPUTimeMicroseconds()
+  {
+    struct timespec ts{};
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID,&ts);
+
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+  }
+}
+
+struct EMANE::SpectrumTools::SpectrumEnergyCompressor::Context
+{
+#ifdef HAVE_ZSTD
+  ZSTD_CCtx * pCCtx_{};
+
+  ~Context()
+  {
+    ZSTD_freeCCtx(pCCtx_);
+  }
+#endif
+};
+
+EMANE::SpectrumTools::SpectrumEnergyCompressor::SpectrumEnergyCompressor():
+  pContext_{},
+  thread_{},
+  mutex_{},
+  condition_{},
+  queue_{},
+  maxQueueDepth_{},
+  bRunning_{},
+  publish_{},
+  compressedBufferPool_{},
+  messages_{},
+  bytesIn_{},
+  bytesOut_{},
+  cpuTimeMicroseconds_{},
+  dropped_{}{}
+
+EMANE::SpectrumTools::SpectrumEnergyCompressor::~SpectrumEnergyCompressor()
+{
+  stop();
+}
+
+bool EMANE::SpectrumTools::SpectrumEnergyCompressor::isAvailable()
+{
+#ifdef HAVE_ZSTD
+  return true;
+#else
+  return false;
+#endif
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyCompressor::start(int iLevel,
+                                                           const std::vector<std::uint8_t> & dictionary,
+                                                           std::size_t maxQueueDepth,
+                                                           Publish publish,
+                                                           const ThreadSchedule & schedule)
+{
+#ifdef HAVE_ZSTD
+  std::unique_ptr<Context> pContext{new Context{}};
+
+  pContext->pCCtx_ = ZSTD_createCCtx();
+
+  if(!pContext->pCCtx_)
+    {
+      throw std::runtime_error{"unable to create zstd compression context"};
+    }
+
+  std::size_t result{ZSTD_CCtx_setParameter(pContext->pCCtx_,ZSTD_c_compressionLevel,iLevel)};
+
+  if(!ZSTD_isError(result) && !dictionary.empty())
+    {
+      // digested once, reused by every compression
+      result = ZSTD_CCtx_loadDictionary(pContext->pCCtx_,dictionary.data(),dictionary.size());
+    }
+
+  if(ZSTD_isError(result))
+    {
+      throw std::runtime_error{std::string{"unable to configure zstd: "} + ZSTD_getErrorName(result)};
+    }
+
+  pContext_ = std::move(pContext);
+  maxQueueDepth_ = maxQueueDepth;
+  publish_ = std::move(publish);
+  bRunning_ = true;
+
+  thread_ = std::thread{&SpectrumEnergyCompressor::run,this,schedule};
+#else
+  (void) iLevel;
+  (void) dictionary;
+  (void) maxQueueDepth;
+  (void) publish;
+  (void) schedule;
+
+  throw std::runtime_error{"built without zstd support"};
+#endif
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyCompressor::stop()
+{
+  {
+    std::lock_guard<std::mutex> m(mutex_);
+
+    bRunning_ = false;
+  }
+
+  condition_.notify_one();
+
+  if(thread_.joinable())
+    {
+      thread_.join();
+    }
+
+  for(auto & entry : queue_)
+    {
+      SerializationBufferPool::release(nullptr,entry.pBuffer_);
+    }
+
+  queue_.clear();
+}
+
+bool EMANE::SpectrumTools::SpectrumEnergyCompressor::enqueue(const std::string * pTopic,
+                                                             std::uint64_t u64Sequence,
+                                                             bool bLastValue,
+                                                             SerializationBufferPool::Buffer * pBuffer)
+{
+  {
+    std::lock_guard<std::mutex> m(mutex_);
+
+    if(queue_.size() < maxQueueDepth_)
+      {
+        queue_.push_back(Entry{pTopic,u64Sequence,bLastValue,pBuffer});
+
+        pBuffer = nullptr;
+      }
+  }
+
+  if(pBuffer)
+    {
+      SerializationBufferPool::release(nullptr,pBuffer);
+
+      ++dropped_;
+
+      return false;
+    }
+
+  condition_.notify_one();
+
+  return true;
+}
+
+EMANE::SpectrumTools::SpectrumEnergyCompressor::Counters
+EMANE::SpectrumTools::SpectrumEnergyCompressor::getCounters() const
+{
+  Counters counters{};
+
+  counters.u64Messages_ = messages_.load(std::memory_order_relaxed);
+  counters.u64BytesIn_ = bytesIn_.load(std::memory_order_relaxed);
+  counters.u64BytesOut_ = bytesOut_.load(std::memory_order_relaxed);
+  counters.u64CPUTimeMicroseconds_ = cpuTimeMicroseconds_.load(std::memory_order_relaxed);
+  counters.u64Dropped_ = dropped_.load(std::memory_order_relaxed);
+
+  return counters;
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyCompressor::run(ThreadSchedule schedule)
+{
+  applyThreadSchedule(schedule);
+
+#ifdef HAVE_ZSTD
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while(true)
+    {
+      condition_.wait(lock,[this]{return !bRunning_ || !queue_.empty();});
+
+      if(!bRunning_)
+        {
+          break;
+        }
+
+      auto entry = queue_.front();
+
+      queue_.pop_front();
+
+      lock.unlock();
+
+      auto pInput = entry.pBuffer_;
+
+      auto start = threadCPUTimeMicroseconds();
+
+      auto pOutput = compressedBufferPool_.acquire(ZSTD_compressBound(pInput->data_.size()));
+
+      std::size_t result{ZSTD_compress2(pContext_->pCCtx_,
+                                        pOutput->data_.data(),
+                                        pOutput->data_.size(),
+                                        pInput->data_.data(),
+                                        pInput->data_.size())};
+
+      cpuTimeMicroseconds_ += threadCPUTimeMicroseconds() - start;
+
+      if(ZSTD_isError(result))
+        {
+          SerializationBufferPool::release(nullptr,pOutput);
+
+          ++dropped_;
+        }
+      else
+        {
+          pOutput->data_.resize(result);
+
+          ++messages_;
+          bytesIn_ += pInput->data_.size();
+          bytesOut_ += result;
+
+          publish_(*entry.pTopic_,entry.u64Sequence_,entry.bLastValue_,pOutput);
+        }
+
+      SerializationBufferPool::release(nullptr,pInput);
+
+      lock.lock();
+    }
+#endif
+}
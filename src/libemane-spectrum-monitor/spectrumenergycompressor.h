@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSPECTRUMENERGYCOMPRESSOR_HEADER_
+#define EMANESPECTRUMTOOLSSPECTRUMENERGYCOMPRESSOR_HEADER_
+
+#include "serializationbufferpool.h"
+#include "threadschedule.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class SpectrumEnergyCompressor
+     *
+     * @brief Compresses serialized spectrum energy messages with zstd
+     * on a worker thread, handing each compressed message to a
+     * publish function on that thread.
+     *
+     * Input buffers are released to their pool once compressed.
+     * Compressed buffers come from a separate pool and are owned by
+     * the publish function.
+     */
+    class SpectrumEnergyCompressor
+    {
+    public:
+      using Publish = std::function<void(const std::string & sTopic,
+                                         std::uint64_t u64Sequence,
+                                         bool bLastValue,
+                                         SerializationBufferPool::Buffer * pBuffer)>;
+
+      struct Counters
+      {
+        std::uint64_t u64Messages_{};
+        std::uint64_t u64BytesIn_{};
+        std::uint64_t u64BytesOut_{};
+        std::uint64_t u64CPUTimeMicroseconds_{};
+        std::uint64_t u64Dropped_{};
+      };
+
+      SpectrumEnergyCompressor();
+
+      ~SpectrumEnergyCompressor();
+
+      // @return true if built with zstd support
+      static bool isAvailable();
+
+      /**
+       * Starts the worker
+       *
+       * @param iLevel zstd compression level
+       * @param dictionary Optional zstd dictionary, see zstd --train
+       * @param maxQueueDepth Messages queued before new messages are
+       * dropped
+       * @param publish Publish function, called on the worker thread
+       * @param schedule Worker thread schedule
+       *
+       * @throw std::runtime_error
+       */
+      void start(int iLevel,
+                 const std::vector<std::uint8_t> & dictionary,
+                 std::size_t maxQueueDepth,
+                 Publish publish,
+                 const ThreadSchedule & schedule);
+
+      void stop();
+
+      /**
+       * Queues a message for compression, taking ownership of the
+       * buffer
+       *
+       * @param pTopic Topic, must outlive the message
+       * @param u64Sequence Message sequence, passed to publish
+       * @param bLastValue Whether the message is the last value of
+       * its topic, passed to publish
+       * @param pBuffer Serialized message
+       *
+       * @return @a false if the queue is full and the message was
+       * dropped
+       */
+      bool enqueue(const std::string * pTopic,
+                   std::uint64_t u64Sequence,
+                   bool bLastValue,
+                   SerializationBufferPool::Buffer * pBuffer);
+
+      Counters getCounters() const;
+
+    private:
+      struct Context;
+
+      std::unique_ptr<Context> pContext_;
+      std::thread thread_;
+      std::mutex mutex_;
+      std::condition_variable condition_;
+      struct Entry
+      {
+        const std::string * pTopic_;
+        std::uint64_t u64Sequence_;
+        bool bLastValue_;
+        SerializationBufferPool::Buffer * pBuffer_;
+      };
+
+      std::deque<Entry> queue_;
+      std::size_t maxQueueDepth_;
+      bool bRunning_;
+      Publish publish_;
+      SerializationBufferPool compressedBufferPool_;
+      std::atomic<std::uint64_t> messages_;
+      std::atomic<std::uint64_t> bytesIn_;
+      std::atomic<std::uint64_t> bytesOut_;
+      std::atomic<std::uint64_t> cpuTimeMicroseconds_;
+      std::atomic<std::uint64_t> dropped_;
+
+      void run(ThreadSchedule schedule);
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSPECTRUMENERGYCOMPRESSOR_HEADER_
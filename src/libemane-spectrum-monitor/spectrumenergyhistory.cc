@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "spectrumenergyhistory.h"
+
+const std::size_t EMANE::SpectrumTools::SpectrumEnergyHistory::TIER_FACTOR;
+const std::size_t EMANE::SpectrumTools::SpectrumEnergyHistory::MAX_TIERS;
+
+EMANE::SpectrumTools::SpectrumEnergyHistory::SpectrumEnergyHistory():
+  tiers_{},
+  binCount_{},
+  current_{},
+  last_{},
+  flush_{}{}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::configure(std::size_t tierCount,
+                                                            std::size_t tierBytes,
+                                                            const Microseconds & queryRate,
+                                                            std::size_t binCount)
+{
+  tiers_.clear();
+
+  binCount_ = binCount;
+
+  Microseconds window{queryRate};
+
+  for(std::size_t i = 0; i < std::min(tierCount,MAX_TIERS); ++i)
+    {
+      tiers_.emplace_back();
+
+      auto & tier = tiers_.back();
+
+      // committed up front, retention never grows memory
+      tier.buffer_.assign(tierBytes,0);
+      tier.u64Head_ = 0;
+      tier.window_ = window;
+      tier.binSize_ = window / binCount;
+      tier.bOpen_ = false;
+      tier.u64FirstSequence_ = 0;
+      tier.u64LastSequence_ = 0;
+
+      window *= TIER_FACTOR;
+    }
+}
+
+bool EMANE::SpectrumTools::SpectrumEnergyHistory::isEnabled() const
+{
+  return !tiers_.empty();
+}
+
+std::size_t EMANE::SpectrumTools::SpectrumEnergyHistory::getTierCount() const
+{
+  return tiers_.size();
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::begin(const EMANESpectrumMonitor::SpectrumEnergy & msg)
+{
+  // cleared messages keep their repeated field storage
+  current_.Clear();
+
+  current_.set_start_time(msg.start_time());
+  current_.set_duration(msg.duration());
+  current_.set_sequence(msg.sequence());
+  current_.set_degradation_level(msg.degradation_level());
+
+  if(msg.has_antenna())
+    {
+      current_.mutable_antenna()->CopyFrom(msg.antenna());
+    }
+
+  if(msg.has_pov())
+    {
+      current_.mutable_pov()->CopyFrom(msg.pov());
+    }
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::add(std::uint16_t u16SubId,
+                                                      std::uint64_t u64BandwidthHz,
+                                                      const NoiseRecorderBackend::EnergySummary & summary,
+                                                      std::size_t firstBin)
+{
+  auto pEntry = current_.add_entries();
+
+  pEntry->set_subid(u16SubId);
+
+  pEntry->set_bandwidth_hz(u64BandwidthHz);
+
+  for(const auto & frequencyEnergy : summary)
+    {
+      auto pEnergy = pEntry->add_energies();
+
+      pEnergy->set_frequency_hz(frequencyEnergy.first);
+
+      for(std::size_t i = firstBin; i < frequencyEnergy.second.size(); ++i)
+        {
+          pEnergy->add_energy_mw(frequencyEnergy.second[i]);
+        }
+    }
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::end()
+{
+  if(tiers_.empty())
+    {
+      return;
+    }
+
+  auto & fullTier = tiers_.front();
+
+  write(fullTier,
+        current_,
+        current_.sequence(),
+        current_.sequence(),
+        current_.start_time(),
+        current_.start_time() + fullTier.window_.count());
+
+  for(std::size_t i = 1; i < tiers_.size(); ++i)
+    {
+      fold(tiers_[i]);
+    }
+
+  // common fields of a coarse tier message are those of the last
+  // query folded into it
+  last_.clear_antenna();
+  last_.clear_pov();
+
+  if(current_.has_antenna())
+    {
+      last_.mutable_antenna()->CopyFrom(current_.antenna());
+    }
+
+  if(current_.has_pov())
+    {
+      last_.mutable_pov()->CopyFrom(current_.pov());
+    }
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::fold(Tier & tier)
+{
+  std::uint64_t u64StartTime{current_.start_time()};
+
+  TimePoint windowStart{Microseconds{u64StartTime - u64StartTime % tier.window_.count()}};
+
+  if(tier.bOpen_ && windowStart != tier.windowStart_)
+    {
+      flush(tier);
+    }
+
+  if(!tier.bOpen_)
+    {
+      tier.bOpen_ = true;
+      tier.windowStart_ = windowStart;
+      tier.u64FirstSequence_ = current_.sequence();
+    }
+
+  tier.u64LastSequence_ = current_.sequence();
+
+  Microseconds sourceBinSize{current_.duration()};
+
+  auto offset = std::chrono::duration_cast<Microseconds>(TimePoint{Microseconds{u64StartTime}} - windowStart);
+
+  for(const auto & entry : current_.entries())
+    {
+      tier.bandwidths_[entry.subid()] = entry.bandwidth_hz();
+
+      for(const auto & energy : entry.energies())
+        {
+          auto & bins = tier.accumulator_[AccumulatorKey{entry.subid(),energy.frequency_hz()}];
+
+          if(bins.empty())
+            {
+              bins.assign(binCount_,0);
+            }
+
+          for(int i = 0; i < energy.energy_mw_size(); ++i)
+            {
+              Microseconds binStart{offset + sourceBinSize * i};
+
+              // a source bin may straddle tier bins when degraded
+              std::size_t first = binStart / tier.binSize_;
+
+              std::size_t last = (binStart + sourceBinSize - Microseconds{1}) / tier.binSize_;
+
+              for(std::size_t bin = first; bin <= last && bin < binCount_; ++bin)
+                {
+                  bins[bin] = std::max(bins[bin],energy.energy_mw(i));
+                }
+            }
+        }
+    }
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::flush(Tier & tier)
+{
+  flush_.Clear();
+
+  std::uint64_t u64StartTime =
+    std::chrono::duration_cast<Microseconds>(tier.windowStart_.time_since_epoch()).count();
+
+  flush_.set_start_time(u64StartTime);
+  flush_.set_duration(tier.binSize_.count());
+  flush_.set_sequence(tier.u64FirstSequence_);
+
+  if(last_.has_antenna())
+    {
+      flush_.mutable_antenna()->CopyFrom(last_.antenna());
+    }
+
+  if(last_.has_pov())
+    {
+      flush_.mutable_pov()->CopyFrom(last_.pov());
+    }
+
+  EMANESpectrumMonitor::SpectrumEnergy::Entry * pEntry{};
+
+  // accumulator keys are ordered by sub id then frequency
+  for(const auto & accumulated : tier.accumulator_)
+    {
+      if(!pEntry || pEntry->subid() != accumulated.first.first)
+        {
+          pEntry = flush_.add_entries();
+
+          pEntry->set_subid(accumulated.first.first);
+
+          pEntry->set_bandwidth_hz(tier.bandwidths_[accumulated.first.first]);
+        }
+
+      auto pEnergy = pEntry->add_energies();
+
+      pEnergy->set_frequency_hz(accumulated.first.second);
+
+      for(const auto & dEnergyMilliWatt : accumulated.second)
+        {
+          pEnergy->add_energy_mw(dEnergyMilliWatt);
+        }
+    }
+
+  write(tier,
+        flush_,
+        tier.u64FirstSequence_,
+        tier.u64LastSequence_,
+        u64StartTime,
+        u64StartTime + tier.window_.count());
+
+  tier.bOpen_ = false;
+  tier.accumulator_.clear();
+  tier.bandwidths_.clear();
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyHistory::write(Tier & tier,
+                                                        const EMANESpectrumMonitor::SpectrumEnergy & msg,
+                                                        std::uint64_t u64FirstSequence,
+                                                        std::uint64_t u64LastSequence,
+                                                        std::uint64_t u64StartTime,
+                                                        std::uint64_t u64EndTime)
+{
+  std::size_t capacity{tier.buffer_.size()};
+
+  std::size_t length{msg.ByteSizeLong()};
+
+  if(length > capacity / 2)
+    {
+      return;
+    }
+
+  std::uint64_t u64Offset{tier.u64Head_ % capacity};
+
+  // records never wrap, skip the end of the ring instead
+  if(capacity - u64Offset < length)
+    {
+      tier.u64Head_ += capacity - u64Offset;
+      u64Offset = 0;
+    }
+
+  std::uint64_t u64End{tier.u64Head_ + length};
+
+  // evict the records about to be overwritten
+  while(!tier.records_.empty() &&
+        tier.records_.front().u64Position_ + capacity < u64End)
+    {
+      tier.records_.pop_front();
+    }
+
+  msg.SerializeWithCachedSizesToArray(tier.buffer_.data() + u64Offset);
+
+  tier.records_.push_back(Record{u64FirstSequence,
+                                 u64LastSequence,
+                                 u64StartTime,
+                                 u64EndTime,
+                                 tier.u64Head_,
+                                 static_cast<std::uint32_t>(length)});
+
+  tier.u64Head_ = u64End;
+}
+
+const std::uint8_t *
+EMANE::SpectrumTools::SpectrumEnergyHistory::data(const Tier & tier,
+                                                  const Record & record) const
+{
+  return tier.buffer_.data() + record.u64Position_ % tier.buffer_.size();
+}
+
+EMANE::Microseconds EMANE::SpectrumTools::SpectrumEnergyHistory::getRetainedDuration() const
+{
+  if(tiers_.empty() || tiers_.back().records_.empty())
+    {
+      return Microseconds::zero();
+    }
+
+  const auto & records = tiers_.back().records_;
+
+  return Microseconds{records.back().u64EndTime_ - records.front().u64StartTime_};
+}
+
+std::size_t EMANE::SpectrumTools::SpectrumEnergyHistory::getCommittedBytes() const
+{
+  std::size_t bytes{current_.SpaceUsedLong() + last_.SpaceUsedLong() + flush_.SpaceUsedLong()};
+
+  for(const auto & tier : tiers_)
+    {
+      bytes += tier.buffer_.capacity() + tier.records_.size() * sizeof(Record);
+
+      for(const auto & accumulated : tier.accumulator_)
+        {
+          bytes += accumulated.second.capacity() * sizeof(double);
+        }
+    }
+
+  return bytes;
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSPECTRUMENERGYHISTORY_HEADER_
+#define EMANESPECTRUMTOOLSSPECTRUMENERGYHISTORY_HEADER_
+
+#include "emane/types.h"
+#include "noiserecorderbackend.h"
+#include "spectrummonitor.pb.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class SpectrumEnergyHistory
+     *
+     * @brief Retains published spectrum energy summaries, beyond the
+     * noise window, in tiers of decreasing time resolution.
+     *
+     * Tier 0 holds each query as published. Each following tier
+     * holds one message per TIER_FACTOR times the window of the tier
+     * before it, with bins TIER_FACTOR times wider, reduced using
+     * max. Every tier is a fixed size ring of serialized
+     * SpectrumEnergy messages, the oldest are evicted as it wraps.
+     */
+    class SpectrumEnergyHistory
+    {
+    public:
+      static const std::size_t TIER_FACTOR{10};
+      static const std::size_t MAX_TIERS{3};
+
+      struct Record
+      {
+        std::uint64_t u64FirstSequence_;
+        std::uint64_t u64LastSequence_;
+        std::uint64_t u64StartTime_; // microseconds since epoch
+        std::uint64_t u64EndTime_;
+        std::uint64_t u64Position_;
+        std::uint32_t u32Length_;
+      };
+
+      SpectrumEnergyHistory();
+
+      /**
+       * Configures the retained tiers
+       *
+       * @param tierCount Number of tiers, 0 disables retention
+       * @param tierBytes Ring size of each tier
+       * @param queryRate Published query window
+       * @param binCount Bins per query window at full resolution
+       */
+      void configure(std::size_t tierCount,
+                     std::size_t tierBytes,
+                     const Microseconds & queryRate,
+                     std::size_t binCount);
+
+      bool isEnabled() const;
+
+      std::size_t getTierCount() const;
+
+      /**
+       * Begins retaining a query, copying its common fields
+       */
+      void begin(const EMANESpectrumMonitor::SpectrumEnergy & msg);
+
+      /**
+       * Adds a sub id to the query begun
+       *
+       * @param firstBin Index of the first summary bin published,
+       * earlier bins are streaming mode revision bins
+       */
+      void add(std::uint16_t u16SubId,
+               std::uint64_t u64BandwidthHz,
+               const NoiseRecorderBackend::EnergySummary & summary,
+               std::size_t firstBin = 0);
+
+      // retains the query begun, folding it into each tier
+      void end();
+
+      /**
+       * Visits retained messages of a tier containing any of the
+       * sequences, given in ascending order
+       *
+       * @param function Callable taking the serialized message and
+       * its length, returning @a false to stop
+       */
+      template<typename Function>
+      void forEachSequence(std::size_t tier,
+                           const std::vector<std::uint64_t> & sequences,
+                           Function function) const;
+
+      /**
+       * Visits retained messages of a tier overlapping [start time,
+       * end time), in time order
+       */
+      template<typename Function>
+      void forEachTime(std::size_t tier,
+                       std::uint64_t u64StartTime,
+                       std::uint64_t u64EndTime,
+                       Function function) const;
+
+      // time retained by the coarsest tier
+      Microseconds getRetainedDuration() const;
+
+      std::size_t getCommittedBytes() const;
+
+    private:
+      using AccumulatorKey = std::pair<std::uint16_t,std::uint64_t>; // sub id, frequency hz
+
+      struct Tier
+      {
+        std::vector<std::uint8_t> buffer_;
+        std::deque<Record> records_;
+        std::uint64_t u64Head_;
+        Microseconds window_;
+        Microseconds binSize_;
+
+        // coarse tiers only, max of the queries in the current window
+        bool bOpen_;
+        TimePoint windowStart_;
+        std::uint64_t u64FirstSequence_;
+        std::uint64_t u64LastSequence_;
+        std::map<AccumulatorKey,std::vector<double>> accumulator_;
+        std::map<std::uint16_t,std::uint64_t> bandwidths_;
+      };
+
+      std::vector<Tier> tiers_;
+      std::size_t binCount_;
+      EMANESpectrumMonitor::SpectrumEnergy current_;
+      EMANESpectrumMonitor::SpectrumEnergy last_;
+      EMANESpectrumMonitor::SpectrumEnergy flush_;
+
+      void write(Tier & tier,
+                 const EMANESpectrumMonitor::SpectrumEnergy & msg,
+                 std::uint64_t u64FirstSequence,
+                 std::uint64_t u64LastSequence,
+                 std::uint64_t u64StartTime,
+                 std::uint64_t u64EndTime);
+
+      void fold(Tier & tier);
+
+      void flush(Tier & tier);
+
+      const std::uint8_t * data(const Tier & tier, const Record & record) const;
+    };
+  }
+}
+
+template<typename Function>
+void EMANE::SpectrumTools::SpectrumEnergyHistory::forEachSequence(std::size_t tier,
+                                                                  const std::vector<std::uint64_t> & sequences,
+                                                                  Function function) const
+{
+  if(tier >= tiers_.size())
+    {
+      return;
+    }
+
+  const auto & records = tiers_[tier].records_;
+
+  const Record * pLast{};
+
+  for(const auto & u64Sequence : sequences)
+    {
+      // records are in sequence order, find the first ending at or
+      // after the sequence
+      auto iter = std::lower_bound(records.begin(),
+                                   records.end(),
+                                   u64Sequence,
+                                   [](const Record & record, std::uint64_t u64Value)
+                                   {
+                                     return record.u64LastSequence_ < u64Value;
+                                   });
+
+      if(iter == records.end() ||
+         iter->u64FirstSequence_ > u64Sequence ||
+         &*iter == pLast)
+        {
+          continue;
+        }
+
+      pLast = &*iter;
+
+      if(!function(data(tiers_[tier],*iter),iter->u32Length_))
+        {
+          break;
+        }
+    }
+}
+
+template<typename Function>
+void EMANE::SpectrumTools::SpectrumEnergyHistory::forEachTime(std::size_t tier,
+                                                              std::uint64_t u64StartTime,
+                                                              std::uint64_t u64EndTime,
+                                                              Function function) const
+{
+  if(tier >= tiers_.size())
+    {
+      return;
+    }
+
+  const auto & records = tiers_[tier].records_;
+
+  auto iter = std::lower_bound(records.begin(),
+                               records.end(),
+                               u64StartTime,
+                               [](const Record & record, std::uint64_t u64Value)
+                               {
+                                 return record.u64EndTime_ <= u64Value;
+                               });
+
+  for(; iter != records.end() && iter->u64StartTime_ < u64EndTime; ++iter)
+    {
+      if(!function(data(tiers_[tier],*iter),iter->u32Length_))
+        {
+          break;
+        }
+    }
+}
+
+#endif // EMANESPECTRUMTOOLSSPECTRUMENERGYHISTORY_HEADER_
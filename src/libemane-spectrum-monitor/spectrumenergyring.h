@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSPECTRUMENERGYRING_HEADER_
+#define EMANESPECTRUMTOOLSSPECTRUMENERGYRING_HEADER_
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * Shared memory layout of the single producer, multiple consumer
+     * ring the monitor publishes serialized SpectrumEnergy messages
+     * to when spectrumquery.shmring.name is set, along with
+     * SpectrumMetadata messages, flagged RECORD_FLAG_METADATA, when
+     * spectrumquery.metadata.enable is on.
+     *
+     * The ring is a header followed by capacity bytes of records.
+     * Positions are monotonic byte counts, the record at position p
+     * is at offset p % capacity. Each record is a Record followed by
+     * its message, padded to RECORD_ALIGNMENT. A record never wraps,
+     * a pad record fills the end of the ring instead.
+     *
+     * The producer stores reserve, writes the record and then stores
+     * head. A record at position p has been read intact when reserve
+     * - p <= capacity after the read.
+     */
+    namespace SpectrumEnergyRing
+    {
+      const std::uint32_t MAGIC{0x45535452}; // ESTR
+      const std::uint32_t VERSION{1};
+      const std::size_t HEADER_SIZE{128};
+      const std::size_t RECORD_ALIGNMENT{16};
+      const std::uint32_t RECORD_FLAG_PAD{0x1};
+      const std::uint32_t RECORD_FLAG_METADATA{0x2};
+
+      struct Header
+      {
+        std::uint32_t u32Magic_;
+        std::uint32_t u32Version_;
+        std::uint64_t u64Capacity_;
+        std::uint64_t u64Unused_[6];
+
+        // written by the producer only
+        std::atomic<std::uint64_t> reserve_;  // end of the record being written
+        std::atomic<std::uint64_t> head_;     // end of the last record
+        std::atomic<std::uint64_t> last_;     // start of the last record
+        std::atomic<std::uint64_t> sequence_; // sequence of the last record
+        std::uint64_t u64Padding_[4];
+      };
+
+      static_assert(sizeof(Header) == HEADER_SIZE,"unexpected ring header size");
+
+      struct Record
+      {
+        std::uint64_t u64Sequence_;
+        std::uint32_t u32Length_;
+        std::uint32_t u32Flags_;
+      };
+
+      static_assert(sizeof(Record) == RECORD_ALIGNMENT,"unexpected ring record size");
+
+      inline std::size_t recordSize(std::size_t length)
+      {
+        return (sizeof(Record) + length + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+      }
+
+      /**
+       * @class Consumer
+       *
+       * @brief Reads records in place from a ring opened by name.
+       *
+       * Reading starts at the newest record at open. A consumer that
+       * falls more than a ring behind skips to the newest record, the
+       * frames skipped are counted as lost using the sequence gap.
+       */
+      class Consumer
+      {
+      public:
+        struct Frame
+        {
+          std::uint64_t u64Sequence_;
+          const std::uint8_t * pData_;
+          std::size_t length_;
+          std::uint32_t u32Flags_;
+        };
+
+        Consumer():
+          pHeader_{},
+          pData_{},
+          mappedBytes_{},
+          u64Capacity_{},
+          u64Position_{},
+          u64FramePosition_{},
+          u64NextSequence_{},
+          u64Lost_{}{}
+
+        ~Consumer()
+        {
+          close();
+        }
+
+        Consumer(const Consumer &) = delete;
+
+        Consumer & operator=(const Consumer &) = delete;
+
+        /**
+         * Opens a ring
+         *
+         * @param sName Shared memory name, /dev/shm/<name>
+         *
+         * @throw std::system_error
+         */
+        void open(const std::string & sName)
+        {
+          close();
+
+          int iFd{shm_open(("/" + sName).c_str(),O_RDONLY,0)};
+
+          if(iFd < 0)
+            {
+              throw std::system_error{errno,std::generic_category(),"shm_open " + sName};
+            }
+
+          struct stat sb{};
+
+          if(fstat(iFd,&sb) < 0 || static_cast<std::size_t>(sb.st_size) < HEADER_SIZE)
+            {
+              int iError{errno ? errno : EINVAL};
+              ::close(iFd);
+              throw std::system_error{iError,std::generic_category(),"invalid ring " + sName};
+            }
+
+          void * p{mmap(nullptr,sb.st_size,PROT_READ,MAP_SHARED,iFd,0)};
+
+          ::close(iFd);
+
+          if(p == MAP_FAILED)
+            {
+              throw std::system_error{errno,std::generic_category(),"mmap " + sName};
+            }
+
+          pHeader_ = static_cast<const Header *>(p);
+          mappedBytes_ = sb.st_size;
+
+          if(pHeader_->u32Magic_ != MAGIC ||
+             pHeader_->u32Version_ != VERSION ||
+             pHeader_->u64Capacity_ + HEADER_SIZE > mappedBytes_)
+            {
+              close();
+              throw std::system_error{EPROTO,std::generic_category(),"unsupported ring " + sName};
+            }
+
+          pData_ = static_cast<const std::uint8_t *>(p) + HEADER_SIZE;
+          u64Capacity_ = pHeader_->u64Capacity_;
+          u64Position_ = pHeader_->head_.load(std::memory_order_acquire);
+          u64NextSequence_ = 0;
+          u64Lost_ = 0;
+        }
+
+        void close()
+        {
+          if(pHeader_)
+            {
+              munmap(const_cast<Header *>(pHeader_),mappedBytes_);
+              pHeader_ = nullptr;
+              pData_ = nullptr;
+            }
+        }
+
+        /**
+         * Gets the next record
+         *
+         * @param frame Set to the record message, valid until the
+         * producer wraps over it, see isValid()
+         *
+         * @return @a true if a record was available
+         */
+        bool next(Frame & frame)
+        {
+          while(true)
+            {
+              std::uint64_t u64Head{pHeader_->head_.load(std::memory_order_acquire)};
+
+              if(u64Position_ == u64Head)
+                {
+                  return false;
+                }
+
+              if(u64Head - u64Position_ > u64Capacity_)
+                {
+                  resync();
+                  continue;
+                }
+
+              std::uint64_t u64Offset{u64Position_ % u64Capacity_};
+
+              Record record = *reinterpret_cast<const Record *>(pData_ + u64Offset);
+
+              u64FramePosition_ = u64Position_;
+
+              if(!isValid() || record.u32Length_ > u64Capacity_ - u64Offset - sizeof(Record))
+                {
+                  resync();
+                  continue;
+                }
+
+              if(record.u32Flags_ & RECORD_FLAG_PAD)
+                {
+                  u64Position_ += u64Capacity_ - u64Offset;
+                  continue;
+                }
+
+              u64Position_ += recordSize(record.u32Length_);
+
+              if(u64NextSequence_ && record.u64Sequence_ > u64NextSequence_)
+                {
+                  u64Lost_ += record.u64Sequence_ - u64NextSequence_;
+                }
+
+              u64NextSequence_ = record.u64Sequence_ + 1;
+
+              frame.u64Sequence_ = record.u64Sequence_;
+              frame.pData_ = pData_ + u64Offset + sizeof(Record);
+              frame.length_ = record.u32Length_;
+              frame.u32Flags_ = record.u32Flags_;
+
+              return true;
+            }
+        }
+
+        /**
+         * Checks that the last frame returned by next() has not been
+         * overwritten, call once done reading it
+         */
+        bool isValid() const
+        {
+          std::atomic_thread_fence(std::memory_order_acquire);
+
+          return pHeader_->reserve_.load(std::memory_order_relaxed) - u64FramePosition_ <= u64Capacity_;
+        }
+
+        // @return frames lost to overruns
+        std::uint64_t getLost() const
+        {
+          return u64Lost_;
+        }
+
+      private:
+        const Header * pHeader_;
+        const std::uint8_t * pData_;
+        std::size_t mappedBytes_;
+        std::uint64_t u64Capacity_;
+        std::uint64_t u64Position_;
+        std::uint64_t u64FramePosition_;
+        std::uint64_t u64NextSequence_;
+        std::uint64_t u64Lost_;
+
+        void resync()
+        {
+          u64Position_ = pHeader_->last_.load(std::memory_order_acquire);
+        }
+      };
+    }
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSPECTRUMENERGYRING_HEADER_
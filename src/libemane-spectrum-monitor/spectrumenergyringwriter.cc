@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "spectrumenergyringwriter.h"
+
+#include <cstring>
+#include <new>
+
+EMANE::SpectrumTools::SpectrumEnergyRingWriter::SpectrumEnergyRingWriter():
+  sName_{},
+  pHeader_{},
+  pData_{},
+  mappedBytes_{},
+  u64Capacity_{},
+  u64Head_{},
+  u64Sequence_{}{}
+
+EMANE::SpectrumTools::SpectrumEnergyRingWriter::~SpectrumEnergyRingWriter()
+{
+  close();
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyRingWriter::open(const std::string & sName,
+                                                          std::size_t capacity)
+{
+  using namespace SpectrumEnergyRing;
+
+  close();
+
+  capacity = (capacity + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+
+  std::string sPath{"/" + sName};
+
+  // start from an empty ring, consumers of a previous ring reopen
+  shm_unlink(sPath.c_str());
+
+  int iFd{shm_open(sPath.c_str(),O_RDWR | O_CREAT | O_EXCL,0644)};
+
+  if(iFd < 0)
+    {
+      throw std::system_error{errno,std::generic_category(),"shm_open " + sName};
+    }
+
+  std::size_t bytes{HEADER_SIZE + capacity};
+
+  if(ftruncate(iFd,bytes) < 0)
+    {
+      int iError{errno};
+      ::close(iFd);
+      shm_unlink(sPath.c_str());
+      throw std::system_error{iError,std::generic_category(),"ftruncate " + sName};
+    }
+
+  void * p{mmap(nullptr,bytes,PROT_READ | PROT_WRITE,MAP_SHARED,iFd,0)};
+
+  ::close(iFd);
+
+  if(p == MAP_FAILED)
+    {
+      int iError{errno};
+      shm_unlink(sPath.c_str());
+      throw std::system_error{iError,std::generic_category(),"mmap " + sName};
+    }
+
+  pHeader_ = new(p) Header{};
+  pData_ = static_cast<std::uint8_t *>(p) + HEADER_SIZE;
+  mappedBytes_ = bytes;
+  u64Capacity_ = capacity;
+  u64Head_ = 0;
+  u64Sequence_ = 0;
+  sName_ = sName;
+
+  pHeader_->u64Capacity_ = capacity;
+  pHeader_->u32Version_ = VERSION;
+
+  // magic last, a consumer accepts the ring once it is set
+  std::atomic_thread_fence(std::memory_order_release);
+
+  pHeader_->u32Magic_ = MAGIC;
+}
+
+void EMANE::SpectrumTools::SpectrumEnergyRingWriter::close()
+{
+  if(pHeader_)
+    {
+      munmap(pHeader_,mappedBytes_);
+
+      shm_unlink(("/" + sName_).c_str());
+
+      pHeader_ = nullptr;
+      pData_ = nullptr;
+    }
+}
+
+bool EMANE::SpectrumTools::SpectrumEnergyRingWriter::isOpen() const
+{
+  return pHeader_ != nullptr;
+}
+
+bool EMANE::SpectrumTools::SpectrumEnergyRingWriter::write(const std::uint8_t * pData,
+                                                           std::size_t length,
+                                                           std::uint32_t u32Flags)
+{
+  using namespace SpectrumEnergyRing;
+
+  std::size_t size{recordSize(length)};
+
+  if(size > u64Capacity_ / 2)
+    {
+      return false;
+    }
+
+  std::uint64_t u64Offset{u64Head_ % u64Capacity_};
+
+  // records never wrap, pad out the end of the ring
+  std::uint64_t u64PadSize{u64Capacity_ - u64Offset < size ? u64Capacity_ - u64Offset : 0};
+
+  std::uint64_t u64Position{u64Head_ + u64PadSize};
+
+  std::uint64_t u64End{u64Position + size};
+
+  // announce the region about to be overwritten before writing it
+  pHeader_->reserve_.store(u64End,std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if(u64PadSize)
+    {
+      Record pad{0,0,RECORD_FLAG_PAD};
+
+      std::memcpy(pData_ + u64Offset,&pad,sizeof(pad));
+
+      u64Offset = 0;
+    }
+
+  Record record{++u64Sequence_,static_cast<std::uint32_t>(length),u32Flags};
+
+  std::memcpy(pData_ + u64Offset,&record,sizeof(record));
+
+  std::memcpy(pData_ + u64Offset + sizeof(record),pData,length);
+
+  pHeader_->last_.store(u64Position,std::memory_order_relaxed);
+
+  pHeader_->sequence_.store(u64Sequence_,std::memory_order_relaxed);
+
+  pHeader_->head_.store(u64End,std::memory_order_release);
+
+  u64Head_ = u64End;
+
+  return true;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSPECTRUMENERGYRINGWRITER_HEADER_
+#define EMANESPECTRUMTOOLSSPECTRUMENERGYRINGWRITER_HEADER_
+
+#include "spectrumenergyring.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class SpectrumEnergyRingWriter
+     *
+     * @brief Producer side of the SpectrumEnergyRing shared memory
+     * ring. Never blocks on consumers, a slow consumer detects the
+     * overrun instead.
+     */
+    class SpectrumEnergyRingWriter
+    {
+    public:
+      SpectrumEnergyRingWriter();
+
+      ~SpectrumEnergyRingWriter();
+
+      SpectrumEnergyRingWriter(const SpectrumEnergyRingWriter &) = delete;
+
+      SpectrumEnergyRingWriter & operator=(const SpectrumEnergyRingWriter &) = delete;
+
+      /**
+       * Creates, or recreates, a ring
+       *
+       * @param sName Shared memory name, /dev/shm/<name>
+       * @param capacity Record bytes, rounded up to the record
+       * alignment
+       *
+       * @throw std::system_error
+       */
+      void open(const std::string & sName, std::size_t capacity);
+
+      void close();
+
+      bool isOpen() const;
+
+      /**
+       * Writes a record
+       *
+       * @param u32Flags Record flags, RECORD_FLAG_METADATA for a
+       * serialized SpectrumMetadata message
+       *
+       * @return @a false if the message is larger than half the
+       * ring and was not written
+       */
+      bool write(const std::uint8_t * pData,
+                 std::size_t length,
+                 std::uint32_t u32Flags = 0);
+
+    private:
+      std::string sName_;
+      SpectrumEnergyRing::Header * pHeader_;
+      std::uint8_t * pData_;
+      std::size_t mappedBytes_;
+      std::uint64_t u64Capacity_;
+      std::uint64_t u64Head_;
+      std::uint64_t u64Sequence_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSPECTRUMENERGYRINGWRITER_HEADER_
@@ -32,7 +32,9 @@
  */
 
 #include "spectrummonitoralt.h"
-#include "noiserecorder.h"
+#include "noiserecordermapbackend.h"
+#include "noisematrixbackend.h"
+#include "noisesegmenttreebackend.h"
 #include "spectralmaskmanager.h"
 
 #include "emane/spectrumserviceexception.h"
@@ -47,17 +49,46 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::SpectrumMonitorAlt(std::uint16_t u16Su
                                                              const Microseconds & maxPropagation,
                                                              const Microseconds & maxDuration,
                                                              const Microseconds & timeSyncThreshold,
-                                                             bool bMaxClamp):
+                                                             bool bMaxClamp,
+                                                             NoiseRecorderBackend::Type backendType,
+                                                             HugePageMode hugePageMode):
   binSize_{binSize},
   maxOffset_{maxOffset},
   maxPropagation_{maxPropagation},
   maxDuration_{maxDuration},
   bMaxClamp_{bMaxClamp},
   timeSyncThreshold_{timeSyncThreshold},
-  u16SubId_{u16SubId}{}
+  u16SubId_{u16SubId}
+{
+  switch(backendType)
+    {
+    case NoiseRecorderBackend::Type::MATRIX:
+      pNoiseRecorderBackend_.reset(new NoiseMatrixBackend{binSize,
+                                                          maxOffset,
+                                                          maxPropagation,
+                                                          maxDuration,
+                                                          hugePageMode});
+      break;
+
+    case NoiseRecorderBackend::Type::SEGMENTTREE:
+      pNoiseRecorderBackend_.reset(new NoiseSegmentTreeBackend{binSize,
+                                                               maxOffset,
+                                                               maxPropagation,
+                                                               maxDuration,
+                                                               hugePageMode});
+      break;
+
+    default:
+      pNoiseRecorderBackend_.reset(new NoiseRecorderMapBackend{binSize,
+                                                               maxOffset,
+                                                               maxPropagation,
+                                                               maxDuration});
+      break;
+    }
+}
 
 
-EMANE::SpectrumTools::SpectrumUpdate
+EMANE::SpectrumTools::SpectrumMonitorAlt::UpdateResult
 EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
                                                  const TimePoint & txTime,
                                                  const Microseconds & propagationDelay,
@@ -70,9 +101,13 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
 
 
 {
+  UpdateResult result{};
+
   if(segments.size() != rxPowersMilliWatt.size())
     {
-      return std::make_tuple(TimePoint{},Microseconds{},Microseconds{},FrequencySegments{},false,0);
+      // nothing to record
+      result.bSuccess_ = true;
+      return result;
     }
 
   // validate txTime in case of time sync issues
@@ -83,23 +118,33 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
       validTxTime = now;
     }
 
-  auto validPropagation = propagationDelay;
-
+  // check all range limits before recording any energy, so that a
+  // message dropped due to a violation leaves the recorder untouched
   if(propagationDelay > maxPropagation_)
     {
-      if(bMaxClamp_)
+      result.u8Violations_ |= UpdateResult::VIOLATION_PROPAGATION;
+    }
+
+  for(const auto & segment : segments)
+    {
+      if(segment.getOffset() > maxOffset_)
         {
-          validPropagation = maxPropagation_;
+          result.u8Violations_ |= UpdateResult::VIOLATION_OFFSET;
         }
-      else
+
+      if(segment.getDuration() > maxDuration_)
         {
-          throw makeException<SpectrumServiceException>("Message propagation %ju usec > max propagation %ju usec and max clamp is %s",
-                                                        propagationDelay.count(),
-                                                        maxPropagation_.count(),
-                                                        bMaxClamp_ ? "on" : "off");
+          result.u8Violations_ |= UpdateResult::VIOLATION_DURATION;
         }
     }
 
+  if(result.u8Violations_ && !bMaxClamp_)
+    {
+      return result;
+    }
+
+  auto validPropagation = std::min(propagationDelay,maxPropagation_);
+
   TimePoint maxEoR{};
   TimePoint minSoR{TimePoint::max()};
 
@@ -110,58 +155,12 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
       TimePoint startOfReception{};
       TimePoint endOfReception{};
 
-      auto validOffset = segment.getOffset();
-
-      if(validOffset > maxOffset_)
-        {
-          if(bMaxClamp_)
-            {
-              validOffset = maxOffset_;
-            }
-          else
-            {
-              throw makeException<SpectrumServiceException>("Segment offset %ju usec > max offset %ju usec and max clamp is %s",
-                                                            validOffset.count(),
-                                                            maxOffset_.count(),
-                                                            bMaxClamp_ ? "on" : "off");
-            }
-        }
-
-      auto validDuration = segment.getDuration();
-
-      if(validDuration > maxDuration_)
-        {
-          if(bMaxClamp_)
-            {
-              validDuration = maxDuration_;
-            }
-          else
-            {
-              throw makeException<SpectrumServiceException>("Segment duration %ju usec > max duration %ju usec and max clamp is %s",
-                                                            validDuration.count(),
-                                                            maxDuration_.count(),
-                                                            bMaxClamp_ ? "on" : "off");
-            }
-        }
+      auto validOffset = std::min(segment.getOffset(),maxOffset_);
 
+      auto validDuration = std::min(segment.getDuration(),maxDuration_);
 
       if(rxPowersMilliWatt[i])
         {
-          auto iter = noiseRecorderMap_.find(segment.getFrequencyHz());
-
-          if(iter == noiseRecorderMap_.end())
-            {
-              iter = noiseRecorderMap_.insert(std::make_pair(segment.getFrequencyHz(),
-                                                             std::unique_ptr<NoiseRecorder>{new NoiseRecorder{binSize_,
-                                                                   maxOffset_,
-                                                                   maxPropagation_,
-                                                                   maxDuration_,
-                                                                   0,
-                                                                   segment.getFrequencyHz(),
-                                                                   u64SegmentBandwidthHz,
-                                                                   0}})).first;
-            }
-
           auto maskOverlap =
             SpectralMaskManager::instance()->getSpectralOverlap(segment.getFrequencyHz(), // tx freq
                                                                 segment.getFrequencyHz(), // rx freq
@@ -193,16 +192,23 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
                 }
 
               std::tie(startOfReception,endOfReception) =
-                iter->second->update(now,
-                                     validTxTime,
-                                     validOffset,
-                                     validPropagation,
-                                     validDuration,
-                                     dOverlapRxPowerMillWatt,
-                                     transmitters,
-                                     u64LowerOverlapFrequencyHz,
-                                     u64UpperOverlapFrequencyHz,
-                                     txAntennaIndex);
+                pNoiseRecorderBackend_->update(now,
+                                               validTxTime,
+                                               validOffset,
+                                               validPropagation,
+                                               validDuration,
+                                               segment.getFrequencyHz(),
+                                               u64SegmentBandwidthHz,
+                                               dOverlapRxPowerMillWatt,
+                                               transmitters,
+                                               u64LowerOverlapFrequencyHz,
+                                               u64UpperOverlapFrequencyHz,
+                                               txAntennaIndex);
+            }
+          else
+            {
+              pNoiseRecorderBackend_->addFrequency(segment.getFrequencyHz(),
+                                                   u64SegmentBandwidthHz);
             }
         }
 
@@ -210,25 +216,22 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::update(const TimePoint & now,
     }
 
 
-  return std::make_tuple(validTxTime,
-                         validPropagation,
-                         std::chrono::duration_cast<Microseconds>(maxEoR - minSoR),
-                         FrequencySegments{},
-                         false,
-                         0);
+  result.bSuccess_ = true;
+
+  result.spectrumUpdate_ = std::make_tuple(validTxTime,
+                                           validPropagation,
+                                           std::chrono::duration_cast<Microseconds>(maxEoR - minSoR),
+                                           FrequencySegments{},
+                                           false,
+                                           0);
+
+  return result;
 }
 
 EMANE::FrequencySet
 EMANE::SpectrumTools::SpectrumMonitorAlt::getFrequencies() const
 {
-  FrequencySet frequencySet;
-
-  for(auto & entry : noiseRecorderMap_)
-    {
-      frequencySet.insert(entry.first);
-    }
-
-  return frequencySet;
+  return pNoiseRecorderBackend_->getFrequencies();
 }
 
 EMANE::SpectrumWindow
@@ -254,18 +257,7 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::request_i(const TimePoint & now,
         }
     }
 
-  const auto iter = noiseRecorderMap_.find(u64FrequencyHz);
-
-  if(iter!= noiseRecorderMap_.end())
-    {
-      auto ret = iter->second->get(now,validDuration,timepoint);
-
-      return std::tuple_cat(std::move(ret),std::make_tuple(binSize_,0,true));
-    }
-  else
-    {
-      return SpectrumWindow{{},{},{},{},false};
-    }
+  return pNoiseRecorderBackend_->get(now,u64FrequencyHz,validDuration,timepoint);
 }
 
 EMANE::SpectrumWindow
@@ -278,12 +270,52 @@ EMANE::SpectrumTools::SpectrumMonitorAlt::request(std::uint64_t u64FrequencyHz,
 
 std::vector<double> EMANE::SpectrumTools::SpectrumMonitorAlt::dump(std::uint64_t u64FrequencyHz) const
 {
-  const auto iter = noiseRecorderMap_.find(u64FrequencyHz);
+  return pNoiseRecorderBackend_->dump(u64FrequencyHz);
+}
+
+std::size_t EMANE::SpectrumTools::SpectrumMonitorAlt::getCommittedBytes(std::uint64_t u64FrequencyHz) const
+{
+  return pNoiseRecorderBackend_->getCommittedBytes(u64FrequencyHz);
+}
+
+EMANE::SpectrumTools::NoiseRecorderBackend::EnergySummary
+EMANE::SpectrumTools::SpectrumMonitorAlt::maxSummary(const TimePoint & startTime,
+                                                     const Microseconds & summaryBinSize,
+                                                     std::size_t summaryBinCount) const
+{
+  auto validDuration = summaryBinSize * summaryBinCount;
+
+  std::size_t validBinCount{summaryBinCount};
 
-  if(iter!= noiseRecorderMap_.end())
+  if(validDuration > maxDuration_)
     {
-      return iter->second->dump();
+      if(bMaxClamp_)
+        {
+          // as with request_i, only the max duration is reduced,
+          // summary bins beyond it hold no energy
+          validBinCount = maxDuration_ / summaryBinSize;
+        }
+      else
+        {
+          throw makeException<SpectrumServiceException>("Summary duration %ju usec > max duration %ju usec and max clamp is %s",
+                                                        validDuration.count(),
+                                                        maxDuration_.count(),
+                                                        bMaxClamp_ ? "on" : "off");
+        }
+    }
+
+  auto summary = pNoiseRecorderBackend_->maxSummary(Clock::now(),
+                                                    startTime,
+                                                    summaryBinSize,
+                                                    validBinCount);
+
+  if(validBinCount != summaryBinCount)
+    {
+      for(auto & frequencyEnergy : summary)
+        {
+          frequencyEnergy.second.resize(summaryBinCount,0);
+        }
     }
 
-  return {};
+  return summary;
 }
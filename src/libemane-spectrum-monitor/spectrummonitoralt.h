@@ -37,7 +37,8 @@
 #include "emane/types.h"
 #include "emane/frequencysegment.h"
 #include "emane/spectrumserviceprovider.h"
-#include "noiserecorder.h"
+#include "noiserecorderbackend.h"
+#include "hugepageallocator.h"
 
 #include <set>
 #include <map>
@@ -62,9 +63,32 @@ namespace EMANE
                          const Microseconds & maxPropagation,
                          const Microseconds & maxDuration,
                          const Microseconds & timeSyncThreshold,
-                         bool bMaxClamp);
+                         bool bMaxClamp,
+                         NoiseRecorderBackend::Type backendType,
+                         HugePageMode hugePageMode);
 
-      SpectrumUpdate
+      struct UpdateResult
+      {
+        enum Violation : std::uint8_t
+          {
+            VIOLATION_NONE = 0x00,
+            VIOLATION_OFFSET = 0x01,
+            VIOLATION_DURATION = 0x02,
+            VIOLATION_PROPAGATION = 0x04,
+          };
+
+        // false when a violation was detected and max clamp is off,
+        // in which case no energy is recorded
+        bool bSuccess_{};
+
+        // bitmask of Violation values detected, clamped or not
+        std::uint8_t u8Violations_{};
+
+        SpectrumUpdate spectrumUpdate_{};
+      };
+
+      // does not throw on range violations, see UpdateResult
+      UpdateResult
       update(const TimePoint & now,
              const TimePoint & txTime,
              const Microseconds & propagationDelay,
@@ -90,9 +114,14 @@ namespace EMANE
 
       std::vector<double> dump(std::uint64_t u64FrequencyHz) const;
 
-    private:
-      using NoiseRecorderMap = std::map<std::uint64_t,std::unique_ptr<NoiseRecorder>>;
+      std::size_t getCommittedBytes(std::uint64_t u64FrequencyHz) const;
+
+      NoiseRecorderBackend::EnergySummary
+      maxSummary(const TimePoint & startTime,
+                 const Microseconds & summaryBinSize,
+                 std::size_t summaryBinCount) const;
 
+    private:
 
       Microseconds binSize_;
       Microseconds maxOffset_;
@@ -100,7 +129,7 @@ namespace EMANE
       Microseconds maxDuration_;
       bool bMaxClamp_;
       Microseconds timeSyncThreshold_;
-      NoiseRecorderMap noiseRecorderMap_;
+      std::unique_ptr<NoiseRecorderBackend> pNoiseRecorderBackend_;
       uint16_t u16SubId_;
     };
   }
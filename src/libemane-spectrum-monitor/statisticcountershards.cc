@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "statisticcountershards.h"
+
+namespace
+{
+  // a cache line of unused counters on either side of each shard so
+  // shards of different threads never share a cache line
+  const std::size_t SHARD_PADDING{64 / sizeof(std::atomic<std::uint64_t>)};
+
+  std::atomic<std::uint64_t> nextInstanceId{};
+
+  struct LocalShard
+  {
+    std::uint64_t u64InstanceId_;
+    std::atomic<std::uint64_t> * pShard_;
+  };
+
+  thread_local std::vector<LocalShard> localShards{};
+}
+
+EMANE::SpectrumTools::StatisticCounterShards::StatisticCounterShards(std::size_t counterCount):
+  u64InstanceId_{++nextInstanceId},
+  counterCount_{counterCount},
+  mutex_{},
+  shards_{},
+  collected_(counterCount,0){}
+
+EMANE::SpectrumTools::StatisticCounterShards::~StatisticCounterShards(){}
+
+EMANE::SpectrumTools::StatisticCounterShards::Counter *
+EMANE::SpectrumTools::StatisticCounterShards::localShard()
+{
+  for(const auto & localShard : localShards)
+    {
+      if(localShard.u64InstanceId_ == u64InstanceId_)
+        {
+          return localShard.pShard_;
+        }
+    }
+
+  return createShard();
+}
+
+EMANE::SpectrumTools::StatisticCounterShards::Counter *
+EMANE::SpectrumTools::StatisticCounterShards::createShard()
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  shards_.emplace_back(new Counter[counterCount_ + 2 * SHARD_PADDING]());
+
+  Counter * pShard{shards_.back().get() + SHARD_PADDING};
+
+  localShards.push_back({u64InstanceId_,pShard});
+
+  return pShard;
+}
+
+std::vector<std::uint64_t> EMANE::SpectrumTools::StatisticCounterShards::collect()
+{
+  std::vector<std::uint64_t> totals(counterCount_,0);
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  for(const auto & pShard : shards_)
+    {
+      for(std::size_t i = 0; i < counterCount_; ++i)
+        {
+          totals[i] += pShard[SHARD_PADDING + i].load(std::memory_order_relaxed);
+        }
+    }
+
+  std::vector<std::uint64_t> growth(counterCount_,0);
+
+  for(std::size_t i = 0; i < counterCount_; ++i)
+    {
+      growth[i] = totals[i] - collected_[i];
+    }
+
+  collected_.swap(totals);
+
+  return growth;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSTATISTICCOUNTERSHARDS_HEADER_
+#define EMANESPECTRUMTOOLSSTATISTICCOUNTERSHARDS_HEADER_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class StatisticCounterShards
+     *
+     * @brief Per thread counter shards for hot path statistics.
+     *
+     * Each thread increments its own shard with plain relaxed loads
+     * and stores, no read-modify-write or lock, since a shard has a
+     * single writer. collect() sums all shards and returns the amount
+     * each counter grew since the previous collect(), to be added to
+     * the corresponding statistic off the hot path.
+     */
+    class StatisticCounterShards
+    {
+    public:
+      explicit StatisticCounterShards(std::size_t counterCount);
+
+      ~StatisticCounterShards();
+
+      void increment(std::size_t index, std::uint64_t u64Value = 1)
+      {
+        auto & counter = localShard()[index];
+
+        counter.store(counter.load(std::memory_order_relaxed) + u64Value,
+                      std::memory_order_relaxed);
+      }
+
+      /**
+       * Gets the growth of each counter since the last collect
+       */
+      std::vector<std::uint64_t> collect();
+
+    private:
+      using Counter = std::atomic<std::uint64_t>;
+
+      std::uint64_t u64InstanceId_;
+      std::size_t counterCount_;
+      std::mutex mutex_;
+      std::vector<std::unique_ptr<Counter[]>> shards_;
+      std::vector<std::uint64_t> collected_;
+
+      Counter * localShard();
+
+      Counter * createShard();
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSTATISTICCOUNTERSHARDS_HEADER_
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "streamingbintracker.h"
+
+EMANE::SpectrumTools::StreamingBinTracker::StreamingBinTracker():
+  binSize_{},
+  revisionBins_{},
+  published_{}{}
+
+void EMANE::SpectrumTools::StreamingBinTracker::configure(const Microseconds & binSize,
+                                                          std::size_t revisionBins)
+{
+  binSize_ = binSize;
+
+  revisionBins_ = revisionBins;
+
+  published_.clear();
+}
+
+std::size_t EMANE::SpectrumTools::StreamingBinTracker::getRevisionBins() const
+{
+  return revisionBins_;
+}
+
+bool EMANE::SpectrumTools::StreamingBinTracker::isRevised(const Published & published,
+                                                          const TimePoint & windowStart,
+                                                          const std::vector<double> & bins) const
+{
+  // bins published by an earlier query are offset by the number of
+  // bins the window has since advanced, queries skipped while
+  // nothing was subscribed to leave less or no overlap
+  if(published.bins_.size() != bins.size() || windowStart < published.windowStart_)
+    {
+      return false;
+    }
+
+  std::size_t offset = std::chrono::duration_cast<Microseconds>(windowStart - published.windowStart_) / binSize_;
+
+  for(std::size_t i = 0; i < revisionBins_ && i + offset < bins.size(); ++i)
+    {
+      if(bins[i] != published.bins_[i + offset])
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSTREAMINGBINTRACKER_HEADER_
+#define EMANESPECTRUMTOOLSSTREAMINGBINTRACKER_HEADER_
+
+#include "emane/types.h"
+#include "noiserecorderbackend.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class StreamingBinTracker
+     *
+     * @brief Tracks the bins published by streaming mode to detect
+     * late receptions changing bins already published.
+     *
+     * Each streaming query covers the bin being published along with
+     * the revision bins before it. Bins are compared against the
+     * values last published for the same time, frequencies with a
+     * changed bin are returned for republication as a revision. Only
+     * frequencies actually published are compared and recorded, so
+     * a frequency not subscribed to is compared against the bins its
+     * subscribers last received.
+     */
+    class StreamingBinTracker
+    {
+    public:
+      StreamingBinTracker();
+
+      /**
+       * Configures the tracker
+       *
+       * @param binSize Streaming bin size
+       * @param revisionBins Number of bins before the published bin
+       * eligible for revision
+       */
+      void configure(const Microseconds & binSize,
+                     std::size_t revisionBins);
+
+      std::size_t getRevisionBins() const;
+
+      /**
+       * Updates the bins published for a sub id
+       *
+       * @param u16SubId Sub id
+       * @param windowStart Start time of the first revision bin
+       * @param summary Energy of the revision bins followed by the
+       * published bin, per frequency
+       * @param isPublished Callable taking a frequency, returning
+       * whether its bins, and any revision, are published
+       *
+       * @return Revision bins of each published frequency with at
+       * least one bin changed since published
+       */
+      template<typename IsPublished>
+      NoiseRecorderBackend::EnergySummary
+      update(std::uint16_t u16SubId,
+             const TimePoint & windowStart,
+             const NoiseRecorderBackend::EnergySummary & summary,
+             IsPublished isPublished);
+
+    private:
+      struct Published
+      {
+        TimePoint windowStart_;
+        std::vector<double> bins_;
+      };
+
+      Microseconds binSize_;
+      std::size_t revisionBins_;
+      std::map<std::uint16_t,std::map<std::uint64_t,Published>> published_;
+
+      bool isRevised(const Published & published,
+                     const TimePoint & windowStart,
+                     const std::vector<double> & bins) const;
+    };
+  }
+}
+
+template<typename IsPublished>
+EMANE::SpectrumTools::NoiseRecorderBackend::EnergySummary
+EMANE::SpectrumTools::StreamingBinTracker::update(std::uint16_t u16SubId,
+                                                  const TimePoint & windowStart,
+                                                  const NoiseRecorderBackend::EnergySummary & summary,
+                                                  IsPublished isPublished)
+{
+  NoiseRecorderBackend::EnergySummary revisions{};
+
+  auto & frequencies = published_[u16SubId];
+
+  for(const auto & frequencyEnergy : summary)
+    {
+      if(!isPublished(frequencyEnergy.first))
+        {
+          continue;
+        }
+
+      auto & published = frequencies[frequencyEnergy.first];
+
+      if(isRevised(published,windowStart,frequencyEnergy.second))
+        {
+          revisions.emplace_back(frequencyEnergy.first,
+                                 std::vector<double>(frequencyEnergy.second.begin(),
+                                                     frequencyEnergy.second.begin() + revisionBins_));
+        }
+
+      published.windowStart_ = windowStart;
+
+      published.bins_.assign(frequencyEnergy.second.begin(),frequencyEnergy.second.end());
+    }
+
+  return revisions;
+}
+
+#endif // EMANESPECTRUMTOOLSSTREAMINGBINTRACKER_HEADER_
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "subscriptiontracker.h"
+
+EMANE::SpectrumTools::SubscriptionTracker::SubscriptionTracker():
+  subscriptions_{}{}
+
+bool EMANE::SpectrumTools::SubscriptionTracker::process(const std::uint8_t * pData,
+                                                        std::size_t length)
+{
+  if(!length)
+    {
+      return false;
+    }
+
+  std::string sPrefix{reinterpret_cast<const char *>(pData) + 1,length - 1};
+
+  switch(pData[0])
+    {
+    case 1:
+      return subscriptions_.insert(std::move(sPrefix)).second;
+
+    case 0:
+      return subscriptions_.erase(sPrefix) != 0;
+
+    default:
+      // not a subscription message
+      return false;
+    }
+}
+
+bool EMANE::SpectrumTools::SubscriptionTracker::empty() const
+{
+  return subscriptions_.empty();
+}
+
+std::size_t EMANE::SpectrumTools::SubscriptionTracker::size() const
+{
+  return subscriptions_.size();
+}
+
+bool EMANE::SpectrumTools::SubscriptionTracker::isSubscribed(const std::string & sTopic) const
+{
+  for(const auto & sPrefix : subscriptions_)
+    {
+      if(!sTopic.compare(0,sPrefix.size(),sPrefix))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
+bool EMANE::SpectrumTools::SubscriptionTracker::isSubscribedWithin(const std::string & sTopicPrefix) const
+{
+  for(const auto & sPrefix : subscriptions_)
+    {
+      // compare over the shorter of the two
+      if(!sTopicPrefix.compare(0,
+                               sPrefix.size(),
+                               sPrefix,
+                               0,
+                               sTopicPrefix.size()))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSSUBSCRIPTIONTRACKER_HEADER_
+#define EMANESPECTRUMTOOLSSUBSCRIPTIONTRACKER_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @class SubscriptionTracker
+     *
+     * @brief Tracks the topic prefixes subscribed to on an XPUB
+     * socket.
+     *
+     * XPUB passes a subscribe message for the first subscriber to a
+     * prefix and an unsubscribe message when the last subscriber to
+     * a prefix leaves, so a set is enough to know what is being
+     * listened to.
+     */
+    class SubscriptionTracker
+    {
+    public:
+      SubscriptionTracker();
+
+      /**
+       * Processes a message received on an XPUB socket
+       *
+       * @param pData Message data, a subscribe (1) or unsubscribe (0)
+       * byte followed by the topic prefix
+       * @param length Message length
+       *
+       * @return @a true if the subscription set changed
+       */
+      bool process(const std::uint8_t * pData, std::size_t length);
+
+      bool empty() const;
+
+      std::size_t size() const;
+
+      /**
+       * Checks whether a message published with a topic reaches any
+       * subscriber
+       *
+       * @param sTopic Topic
+       *
+       * @return @a true if a subscription is a prefix of the topic
+       */
+      bool isSubscribed(const std::string & sTopic) const;
+
+      /**
+       * Checks whether a message published with a topic starting
+       * with a prefix may reach any subscriber
+       *
+       * @param sTopicPrefix Topic prefix
+       *
+       * @return @a true if a subscription is a prefix of the topic
+       * prefix or extends it
+       */
+      bool isSubscribedWithin(const std::string & sTopicPrefix) const;
+
+    private:
+      std::set<std::string> subscriptions_;
+    };
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSSUBSCRIPTIONTRACKER_HEADER_
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSTHREADSCHEDULE_HEADER_
+#define EMANESPECTRUMTOOLSTHREADSCHEDULE_HEADER_
+
+#include <cerrno>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace EMANE
+{
+  namespace SpectrumTools
+  {
+    /**
+     * @struct ThreadSchedule
+     *
+     * @brief CPU affinity and scheduling policy for a thread role.
+     *
+     * @note Header only, shared by the applications and the monitor
+     * physical layer.
+     */
+    struct ThreadSchedule
+    {
+      std::vector<int> cpus_{}; // empty leaves affinity unchanged
+      int iPolicy_{-1}; // -1 leaves policy and priority unchanged
+      int iPriority_{};
+    };
+
+    /**
+     * Parses a thread schedule: CPULIST[:POLICY[:PRIORITY]]
+     *
+     * CPULIST is a comma separated list of cpus and cpu ranges
+     * (0,2-3) and may be empty. POLICY is one of other, batch, idle,
+     * fifo or rr. PRIORITY is [1,99] for fifo and rr, default 50, and
+     * 0 otherwise.
+     *
+     * @throw std::invalid_argument
+     */
+    inline ThreadSchedule parseThreadSchedule(const std::string & sSchedule)
+    {
+      ThreadSchedule schedule{};
+
+      std::vector<std::string> fields{};
+
+      std::stringstream ss{sSchedule};
+
+      std::string sField{};
+
+      while(std::getline(ss,sField,':'))
+        {
+          fields.push_back(sField);
+        }
+
+      if(fields.empty() || fields.size() > 3)
+        {
+          throw std::invalid_argument{"invalid thread schedule: " + sSchedule};
+        }
+
+      std::stringstream cpus{fields[0]};
+
+      std::string sCPUs{};
+
+      while(std::getline(cpus,sCPUs,','))
+        {
+          auto pos = sCPUs.find('-');
+
+          int iFirst{std::stoi(sCPUs.substr(0,pos))};
+
+          int iLast{pos == std::string::npos ? iFirst : std::stoi(sCPUs.substr(pos + 1))};
+
+          if(iFirst < 0 || iLast < iFirst || iLast >= CPU_SETSIZE)
+            {
+              throw std::invalid_argument{"invalid thread schedule cpus: " + fields[0]};
+            }
+
+          for(int i = iFirst; i <= iLast; ++i)
+            {
+              schedule.cpus_.push_back(i);
+            }
+        }
+
+      if(fields.size() > 1)
+        {
+          if(fields[1] == "other")
+            {
+              schedule.iPolicy_ = SCHED_OTHER;
+            }
+          else if(fields[1] == "batch")
+            {
+              schedule.iPolicy_ = SCHED_BATCH;
+            }
+          else if(fields[1] == "idle")
+            {
+              schedule.iPolicy_ = SCHED_IDLE;
+            }
+          else if(fields[1] == "fifo")
+            {
+              schedule.iPolicy_ = SCHED_FIFO;
+            }
+          else if(fields[1] == "rr")
+            {
+              schedule.iPolicy_ = SCHED_RR;
+            }
+          else
+            {
+              throw std::invalid_argument{"invalid thread schedule policy: " + fields[1]};
+            }
+
+          bool bRealtime{schedule.iPolicy_ == SCHED_FIFO || schedule.iPolicy_ == SCHED_RR};
+
+          schedule.iPriority_ = bRealtime ? 50 : 0;
+
+          if(fields.size() > 2)
+            {
+              schedule.iPriority_ = std::stoi(fields[2]);
+
+              if(bRealtime ?
+                 (schedule.iPriority_ < 1 || schedule.iPriority_ > 99) :
+                 schedule.iPriority_ != 0)
+                {
+                  throw std::invalid_argument{"invalid thread schedule priority: " + fields[2]};
+                }
+            }
+        }
+      else if(schedule.cpus_.empty())
+        {
+          throw std::invalid_argument{"invalid thread schedule: " + sSchedule};
+        }
+
+      return schedule;
+    }
+
+    inline std::string formatThreadSchedule(const ThreadSchedule & schedule)
+    {
+      std::stringstream ss{};
+
+      ss<<"cpus ";
+
+      if(schedule.cpus_.empty())
+        {
+          ss<<"unchanged";
+        }
+      else
+        {
+          for(std::size_t i = 0; i < schedule.cpus_.size(); ++i)
+            {
+              ss<<(i ? "," : "")<<schedule.cpus_[i];
+            }
+        }
+
+      ss<<" policy ";
+
+      switch(schedule.iPolicy_)
+        {
+        case SCHED_OTHER:
+          ss<<"other";
+          break;
+        case SCHED_BATCH:
+          ss<<"batch";
+          break;
+        case SCHED_IDLE:
+          ss<<"idle";
+          break;
+        case SCHED_FIFO:
+          ss<<"fifo";
+          break;
+        case SCHED_RR:
+          ss<<"rr";
+          break;
+        default:
+          ss<<"unchanged";
+          break;
+        }
+
+      if(schedule.iPolicy_ != -1)
+        {
+          ss<<" priority "<<schedule.iPriority_;
+        }
+
+      return ss.str();
+    }
+
+    /**
+     * Applies a thread schedule to the calling thread. Threads it
+     * creates afterwards inherit the schedule.
+     *
+     * @return 0 on success, otherwise an errno value
+     */
+    inline int applyThreadSchedule(const ThreadSchedule & schedule)
+    {
+      if(!schedule.cpus_.empty())
+        {
+          cpu_set_t cpuSet;
+
+          CPU_ZERO(&cpuSet);
+
+          for(const auto & iCPU : schedule.cpus_)
+            {
+              CPU_SET(iCPU,&cpuSet);
+            }
+
+          if(int iError = pthread_setaffinity_np(pthread_self(),sizeof(cpuSet),&cpuSet))
+            {
+              return iError;
+            }
+        }
+
+      if(schedule.iPolicy_ != -1)
+        {
+          struct sched_param schedParam{schedule.iPriority_};
+
+          if(int iError = pthread_setschedparam(pthread_self(),schedule.iPolicy_,&schedParam))
+            {
+              return iError;
+            }
+        }
+
+      return 0;
+    }
+  }
+}
+
+#endif // EMANESPECTRUMTOOLSTHREADSCHEDULE_HEADER_
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESPECTRUMTOOLSTRACEPROBES_HEADER_
+#define EMANESPECTRUMTOOLSTRACEPROBES_HEADER_
+
+// USDT static tracepoints under the emane_spectrum_tools provider,
+// for use with bpftrace, perf or systemtap. Enabled when configure
+// finds sys/sdt.h, otherwise the probes compile to nothing. A probe
+// site is a single nop until attached, so arguments are limited to
+// values already at hand.
+//
+// emane-spectrum-monitor (libemane-spectrum-monitor):
+//  packet_ingress(src, dst, subid, tx time usec, rx time usec)
+//  packet_egress(src, dst, subid, egress time usec)
+//  packet_drop(src, dst, subid, ReceiveProcessorAlt::ProcessResult::Status)
+//  spectrum_update(subid, segment count, success, violations)
+//  query_start(sequence, start time usec, degradation level)
+//  query_end(sequence, serialized bytes)
+//  zmq_send(sequence, bytes, result)
+//  recorder_write(sequence, bytes)
+//
+// emane-spectrum-ota-recorder:
+//  ota_reassembly_complete(src, sequence, part count, bytes)
+//  recorder_write(record type, bytes)
+
+#ifdef HAVE_SYS_SDT_H
+
+#include <sys/sdt.h>
+
+#define EMANE_SPECTRUM_TOOLS_PROBE2(name,a1,a2)                 \
+  DTRACE_PROBE2(emane_spectrum_tools,name,a1,a2)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE3(name,a1,a2,a3)              \
+  DTRACE_PROBE3(emane_spectrum_tools,name,a1,a2,a3)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE4(name,a1,a2,a3,a4)           \
+  DTRACE_PROBE4(emane_spectrum_tools,name,a1,a2,a3,a4)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE5(name,a1,a2,a3,a4,a5)        \
+  DTRACE_PROBE5(emane_spectrum_tools,name,a1,a2,a3,a4,a5)
+
+#else
+
+#define EMANE_SPECTRUM_TOOLS_PROBE2(name,a1,a2) do{}while(0)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE3(name,a1,a2,a3) do{}while(0)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE4(name,a1,a2,a3,a4) do{}while(0)
+
+#define EMANE_SPECTRUM_TOOLS_PROBE5(name,a1,a2,a3,a4,a5) do{}while(0)
+
+#endif
+
+#endif // EMANESPECTRUMTOOLSTRACEPROBES_HEADER_
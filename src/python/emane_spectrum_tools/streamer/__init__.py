@@ -31,3 +31,5 @@
 #
 
 from .spectrumenergystreamer import SpectrumEnergyStreamer
+from .spectrumenergyring import SpectrumEnergyRingReader
+from .spectrummetadatajoiner import SpectrumMetadataJoiner
@@ -0,0 +1,139 @@
+#
+# Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# * Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+# * Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in
+#   the documentation and/or other materials provided with the
+#   distribution.
+# * Neither the name of Adjacent Link LLC nor the names of its
+#   contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+from __future__ import absolute_import, division, print_function
+
+import mmap
+import os
+import struct
+
+class SpectrumEnergyRingReader(object):
+    """Reads serialized SpectrumEnergy messages, and SpectrumMetadata
+    messages flagged RECORD_FLAG_METADATA, from the shared memory ring
+    written by the monitor when spectrumquery.shmring.name is
+    set. Layout matches spectrumenergyring.h."""
+
+    MAGIC = 0x45535452
+    VERSION = 1
+    HEADER_SIZE = 128
+    RECORD_SIZE = 16
+    RECORD_ALIGNMENT = 16
+    RECORD_FLAG_PAD = 0x1
+    RECORD_FLAG_METADATA = 0x2
+
+    # header field offsets
+    _CAPACITY = 8
+    _RESERVE = 64
+    _HEAD = 72
+    _LAST = 80
+
+    def __init__(self,name):
+        fd = os.open(os.path.join('/dev/shm',name),os.O_RDONLY)
+
+        try:
+            self._mm = mmap.mmap(fd,0,mmap.MAP_SHARED,mmap.PROT_READ)
+        finally:
+            os.close(fd)
+
+        magic,version,capacity = struct.unpack_from('<IIQ',self._mm,0)
+
+        if magic != SpectrumEnergyRingReader.MAGIC or \
+           version != SpectrumEnergyRingReader.VERSION or \
+           capacity + SpectrumEnergyRingReader.HEADER_SIZE > len(self._mm):
+            self._mm.close()
+            raise ValueError('unsupported spectrum energy ring: {}'.format(name))
+
+        self._view = memoryview(self._mm)
+        self._capacity = capacity
+        self._position = self._load(SpectrumEnergyRingReader._HEAD)
+        self._frame_position = self._position
+        self._next_sequence = 0
+        self._lost = 0
+
+    def _load(self,offset):
+        return struct.unpack_from('<Q',self._mm,offset)[0]
+
+    def close(self):
+        self._view.release()
+        self._mm.close()
+
+    def lost(self):
+        """Frames lost to overruns."""
+        return self._lost
+
+    def is_valid(self):
+        """Checks that the last frame returned by next() has not been
+        overwritten. Call once done reading it."""
+        return self._load(SpectrumEnergyRingReader._RESERVE) - self._frame_position <= self._capacity
+
+    def next(self):
+        """Gets the next frame as a (sequence, memoryview, flags) tuple, or
+        None when no frame is available. The memoryview references
+        the ring, see is_valid()."""
+        while True:
+            head = self._load(SpectrumEnergyRingReader._HEAD)
+
+            if self._position == head:
+                return None
+
+            if head - self._position > self._capacity:
+                self._position = self._load(SpectrumEnergyRingReader._LAST)
+                continue
+
+            offset = self._position % self._capacity
+
+            data_offset = SpectrumEnergyRingReader.HEADER_SIZE + offset
+
+            sequence,length,flags = struct.unpack_from('<QII',self._mm,data_offset)
+
+            self._frame_position = self._position
+
+            if not self.is_valid() or \
+               length > self._capacity - offset - SpectrumEnergyRingReader.RECORD_SIZE:
+                self._position = self._load(SpectrumEnergyRingReader._LAST)
+                continue
+
+            if flags & SpectrumEnergyRingReader.RECORD_FLAG_PAD:
+                self._position += self._capacity - offset
+                continue
+
+            alignment = SpectrumEnergyRingReader.RECORD_ALIGNMENT
+
+            self._position += (SpectrumEnergyRingReader.RECORD_SIZE + length + alignment - 1) & ~(alignment - 1)
+
+            if self._next_sequence and sequence > self._next_sequence:
+                self._lost += sequence - self._next_sequence
+
+            self._next_sequence = sequence + 1
+
+            start = data_offset + SpectrumEnergyRingReader.RECORD_SIZE
+
+            return (sequence,self._view[start:start+length],flags)
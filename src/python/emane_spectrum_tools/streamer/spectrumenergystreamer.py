@@ -36,17 +36,29 @@ import zmq
 import threading
 import traceback
 import copy
+import time
 from collections import namedtuple
 from collections import defaultdict
 
 import emane_spectrum_tools.interface.spectrummonitor_pb2 as spectrummonitor_pb2
+from .spectrumenergyring import SpectrumEnergyRingReader
+from .spectrummetadatajoiner import SpectrumMetadataJoiner, METADATA_TOPIC
+
+# zstd frame magic, serialized SpectrumEnergy messages start with a
+# field tag and never match
+ZSTD_MAGIC = b'\x28\xb5\x2f\xfd'
 
 class SpectrumEnergyStreamer(object):
     class SubIdInfo(namedtuple('SubIdInfo',['bandwidth_hz'])):
         pass
 
-    def __init__(self,endpoint):
+    def __init__(self,endpoint,subscriptions=None,dictionary=None,snapshot_endpoint=None):
         self._endpoint = endpoint
+        self._snapshot_endpoint = snapshot_endpoint
+        self._subscriptions = subscriptions if subscriptions else ['']
+        self._dictionary = dictionary
+        self._decompressor = None
+        self._joiner = SpectrumMetadataJoiner()
         self._cancel_event = threading.Event()
 
         self._receiver_sensitivity_dBm = 0
@@ -63,13 +75,28 @@ class SpectrumEnergyStreamer(object):
         thread.start()
 
     def _run(self):
+        if self._endpoint.startswith('shm:'):
+            self._run_ring(self._endpoint[4:])
+            return
+
         context = zmq.Context()
 
         subscriber = context.socket(zmq.SUB)
 
         subscriber.connect("tcp://"+self._endpoint)
 
-        subscriber.setsockopt(zmq.SUBSCRIBE, b'')
+        # metadata is needed to rejoin energy when published
+        # separately
+        if '' not in self._subscriptions:
+            subscriber.setsockopt(zmq.SUBSCRIBE, METADATA_TOPIC)
+
+        for subscription in self._subscriptions:
+            subscriber.setsockopt(zmq.SUBSCRIBE, subscription.encode())
+
+        # subscribed before the snapshot is requested so nothing
+        # published in between is missed
+        if self._snapshot_endpoint:
+            self._request_snapshot(context)
 
         poller = zmq.Poller()
 
@@ -85,20 +112,99 @@ class SpectrumEnergyStreamer(object):
 
                     msgs = subscriber.recv_multipart()
 
-                    self.update(msgs[1])
+                    self.update(msgs[1],msgs[0].startswith(METADATA_TOPIC))
 
         except KeyboardInterrupt:
             print(traceback.format_exc())
 
+    def _request_snapshot(self,context):
+        requester = context.socket(zmq.REQ)
+
+        requester.setsockopt(zmq.LINGER, 0)
+
+        requester.connect("tcp://"+self._snapshot_endpoint)
+
+        try:
+            for subscription in self._subscriptions:
+                requester.send(subscription.encode())
+
+                # a monitor without a last value cache never answers
+                if not requester.poll(1000):
+                    print("no snapshot reply from", self._snapshot_endpoint)
+                    return
+
+                msgs = requester.recv_multipart()
+
+                # a single empty frame when nothing is cached
+                for topic,data in zip(msgs[0::2],msgs[1::2]):
+                    self.update(data,topic.startswith(METADATA_TOPIC))
+        finally:
+            requester.close()
+
+    def _run_ring(self,name):
+        reader = SpectrumEnergyRingReader(name)
+
+        try:
+            while not self._cancel_event.is_set():
+                frame = reader.next()
+
+                if frame is None:
+                    time.sleep(0.01)
+                    continue
+
+                # parse from a copy, the ring may be overwritten
+                # while parsing
+                data = bytes(frame[1])
+
+                if reader.is_valid():
+                    self.update(data,
+                                bool(frame[2] & SpectrumEnergyRingReader.RECORD_FLAG_METADATA))
+
+        except KeyboardInterrupt:
+            print(traceback.format_exc())
+
+        finally:
+            reader.close()
+
     def stop(self):
         self._cancel_event.set()
 
-    def update(self,serialized_measurement):
+    def _decompress(self,data):
+        if self._decompressor is None:
+            # only required when the monitor compresses
+            import zstandard
+
+            if self._dictionary:
+                with open(self._dictionary,'rb') as fd:
+                    dict_data = zstandard.ZstdCompressionDict(fd.read())
+
+                self._decompressor = zstandard.ZstdDecompressor(dict_data=dict_data)
+            else:
+                self._decompressor = zstandard.ZstdDecompressor()
+
+        return self._decompressor.decompress(data)
+
+    def update(self,serialized_measurement,metadata=False):
+
+        if serialized_measurement[:4] == ZSTD_MAGIC:
+            serialized_measurement = self._decompress(serialized_measurement)
+
+        if metadata:
+            self._joiner.update(serialized_measurement)
+            return
 
         measurement = spectrummonitor_pb2.SpectrumEnergy()
 
         measurement.ParseFromString(serialized_measurement)
 
+        # a streaming revision repeats bins already displayed, only
+        # the latest bins are of interest
+        if measurement.revision:
+            return
+
+        if not self._joiner.join(measurement):
+            return
+
         subid_bandwidth_map = {}
 
         self._lock.acquire()
@@ -0,0 +1,83 @@
+#
+# Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# * Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+# * Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in
+#   the documentation and/or other materials provided with the
+#   distribution.
+# * Neither the name of Adjacent Link LLC nor the names of its
+#   contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+
+from __future__ import absolute_import, division, print_function
+
+import emane_spectrum_tools.interface.spectrummonitor_pb2 as spectrummonitor_pb2
+
+METADATA_TOPIC = b'EMANE.SpectrumTools.MonitorPhy.SpectrumMetadata'
+
+# length prefix flag of a recorded SpectrumMetadata message
+METADATA_FRAME_FLAG = 0x80000000
+
+class SpectrumMetadataJoiner(object):
+    """Rejoins SpectrumEnergy messages published with a
+    metadata_version, when spectrumquery.metadata.enable is on, with
+    the antenna, pov and subid bandwidths of the matching
+    SpectrumMetadata message."""
+
+    def __init__(self):
+        self._metadata = None
+
+    def update(self,serialized_metadata):
+        metadata = spectrummonitor_pb2.SpectrumMetadata()
+
+        metadata.ParseFromString(serialized_metadata)
+
+        # metadata arrives in publish order, so the latest message is
+        # always current. Versions only increase within a monitor run
+        # but begin again when the monitor restarts.
+        self._metadata = metadata
+
+    def join(self,measurement):
+        """Fills in the metadata fields of a SpectrumEnergy message.
+        Returns False when the referenced version has not been
+        received, in which case the message should be skipped."""
+        if not measurement.HasField('metadata_version'):
+            return True
+
+        if self._metadata is None or \
+           self._metadata.version != measurement.metadata_version:
+            return False
+
+        measurement.antenna.CopyFrom(self._metadata.antenna)
+
+        if self._metadata.HasField('pov'):
+            measurement.pov.CopyFrom(self._metadata.pov)
+
+        bandwidths = {entry.subid : entry.bandwidth_hz for entry in self._metadata.entries}
+
+        for entry in measurement.entries:
+            if entry.subid in bandwidths:
+                entry.bandwidth_hz = bandwidths[entry.subid]
+
+        return True
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compares the matrix and segment tree noise recorder backends for
+ * segments spanning a few to many bins. Not run by make check, run
+ * ./noiserecorderbackendbenchmark after make check builds it.
+ *
+ * Exits non-zero when the backends produce different summaries.
+ */
+
+#include "noisematrixbackend.h"
+#include "noisesegmenttreebackend.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+  const std::size_t RECEPTIONS{20000};
+  const std::size_t FREQUENCIES{8};
+  const std::size_t RECEPTIONS_PER_SUMMARY{500};
+
+  template<typename Backend>
+  double run(Backend & backend,
+             const EMANE::Microseconds & duration,
+             double & dCheckSum)
+  {
+    using namespace EMANE;
+
+    std::mt19937 generator{7};
+
+    TimePoint now{Microseconds{1700000000000000}};
+
+    dCheckSum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(std::size_t i = 0; i < RECEPTIONS; ++i)
+      {
+        now += Microseconds{200};
+
+        backend.update(now,
+                       now,
+                       Microseconds::zero(),
+                       Microseconds{10},
+                       duration,
+                       2400000000ULL + (generator() % FREQUENCIES) * 1000000ULL,
+                       1,
+                       1e-9 * (generator() % 100 + 1),
+                       {},
+                       0,
+                       0,
+                       0);
+
+        // a spectrum query summarizing the last complete 100 msec
+        if(i % RECEPTIONS_PER_SUMMARY == RECEPTIONS_PER_SUMMARY - 1)
+          {
+            auto count = std::chrono::duration_cast<Microseconds>(now.time_since_epoch()).count();
+
+            TimePoint summaryStart{Microseconds{(count / 100000 - 1) * 100000}};
+
+            for(const auto & summary : backend.maxSummary(now,summaryStart,Microseconds{10000},10))
+              {
+                for(const auto & dEnergyMilliWatt : summary.second)
+                  {
+                    dCheckSum += dEnergyMilliWatt;
+                  }
+              }
+          }
+      }
+
+    return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+}
+
+int main()
+{
+  using namespace EMANE;
+  using namespace EMANE::SpectrumTools;
+
+  int iStatus{};
+
+  std::printf("%8s %9s %12s %12s %s\n","bin_us","burst_us","matrix_ms","segtree_ms","match");
+
+  for(auto binSize : {Microseconds{1000},Microseconds{100},Microseconds{10}})
+    {
+      for(auto duration : {Microseconds{1000},Microseconds{10000},Microseconds{100000},Microseconds{1000000}})
+        {
+          // keep the matrix run time reasonable
+          if(duration / binSize > 100000)
+            {
+              continue;
+            }
+
+          NoiseMatrixBackend matrix{binSize,
+                                    Microseconds{300000},
+                                    Microseconds{200000},
+                                    Microseconds{1000000},
+                                    HugePageMode::NONE};
+
+          NoiseSegmentTreeBackend segmentTree{binSize,
+                                              Microseconds{300000},
+                                              Microseconds{200000},
+                                              Microseconds{1000000},
+                                              HugePageMode::NONE};
+
+          double dMatrixCheckSum{};
+          double dSegmentTreeCheckSum{};
+
+          double dMatrixMilliseconds = run(matrix,duration,dMatrixCheckSum);
+
+          double dSegmentTreeMilliseconds = run(segmentTree,duration,dSegmentTreeCheckSum);
+
+          bool bMatch{std::fabs(dMatrixCheckSum - dSegmentTreeCheckSum) <= 1e-9 * std::fabs(dMatrixCheckSum)};
+
+          if(!bMatch)
+            {
+              iStatus = 1;
+            }
+
+          std::printf("%8jd %9jd %12.1f %12.1f %s\n",
+                      static_cast<intmax_t>(binSize.count()),
+                      static_cast<intmax_t>(duration.count()),
+                      dMatrixMilliseconds,
+                      dSegmentTreeMilliseconds,
+                      bMatch ? "yes" : "NO");
+        }
+    }
+
+  return iStatus;
+}
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#  * Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+#  * Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+#  * Neither the name of Adjacent Link LLC nor the names of its
+#    contributors may be used to endorse or promote products derived
+#    from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# See toplevel COPYING for more information.
+#
+
+
+# Converts a streaming mode recording, streamed bins followed by a
+# revision of the bins before them, with the
+# emane-spectrum-energy-recording-tool and checks each bin is written
+# as a row of the configured width, the revised bins superseding the
+# rows of the bins they revise.
+
+from __future__ import absolute_import, division, print_function
+
+import os
+import sqlite3
+import struct
+import subprocess
+import sys
+import tempfile
+
+import emane_spectrum_tools.interface.spectrummonitor_pb2 as spectrummonitor_pb2
+
+RECORDING_TOOL = os.environ.get('RECORDING_TOOL',
+                                os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                             '..',
+                                             'src',
+                                             'python',
+                                             'scripts',
+                                             'emane-spectrum-energy-recording-tool'))
+
+BIN_SIZE = 100
+
+FREQUENCY_HZ = 2400000000
+
+# sequence, start time, energies in mW, revision
+RECORDS = [(1,1000,[1.0],False),
+           (2,1100,[2.0],False),
+           (3,1200,[3.0],False),
+           (4,1000,[1.5,2.5],True)]
+
+# start time, sequence, energy in mW of each row written
+EXPECTED_ROWS = sorted([(1000,1,1.0),
+                        (1100,2,2.0),
+                        (1200,3,3.0),
+                        (1000,4,1.5),
+                        (1100,4,2.5)])
+
+def write_recording(path):
+    with open(path,'wb') as fd:
+        for sequence,start_time,energies,revision in RECORDS:
+            record = spectrummonitor_pb2.SpectrumEnergy()
+
+            record.start_time = start_time
+            record.duration = BIN_SIZE
+            record.sequence = sequence
+            record.antenna.fixed_gain_dbi = 0
+
+            if revision:
+                record.revision = True
+
+            entry = record.entries.add()
+
+            entry.subid = 1
+            entry.bandwidth_hz = 1000000
+
+            energy = entry.energies.add()
+
+            energy.frequency_hz = FREQUENCY_HZ
+            energy.energy_mW.extend(energies)
+
+            data = record.SerializeToString()
+
+            fd.write(struct.pack('!L',len(data)))
+            fd.write(data)
+
+def convert(recording,output,output_format):
+    subprocess.check_call([sys.executable,
+                           RECORDING_TOOL,
+                           '--no-progress',
+                           '--format',
+                           output_format,
+                           recording,
+                           output])
+
+def check(rows,label):
+    if sorted(rows) != EXPECTED_ROWS:
+        print('{}: expected rows {} found {}'.format(label,EXPECTED_ROWS,sorted(rows)))
+        return False
+
+    print('{}: {} rows'.format(label,len(rows)))
+
+    return True
+
+def check_csv(path):
+    with open(path) as fd:
+        lines = fd.read().splitlines()
+
+    header = lines[0].split(',')
+
+    rows = []
+
+    for line in lines[1:]:
+        fields = line.split(',')
+
+        if len(fields) != len(header):
+            print('csv: row width {} != header width {}: {}'.format(len(fields),len(header),line))
+            return False
+
+        row = dict(zip(header,fields))
+
+        rows.append((int(row['start_time']),int(row['sequence']),float(row['bin_0'])))
+
+    return check(rows,'csv')
+
+def check_sqlitedb(path):
+    connection = sqlite3.connect(path)
+
+    rows = connection.execute('SELECT start_time,sequence,bin_0 FROM energy').fetchall()
+
+    connection.close()
+
+    return check(rows,'sqlitedb')
+
+def main():
+    directory = tempfile.mkdtemp()
+
+    recording = os.path.join(directory,'energy.data')
+
+    write_recording(recording)
+
+    csv = os.path.join(directory,'energy.csv')
+
+    convert(recording,csv,'csv')
+
+    sqlitedb = os.path.join(directory,'energy.sqlite')
+
+    convert(recording,sqlitedb,'sqlitedb')
+
+    success = check_csv(csv) and check_sqlitedb(sqlitedb)
+
+    for path in (recording,csv,sqlitedb):
+        os.remove(path)
+
+    os.rmdir(directory)
+
+    return 0 if success else 1
+
+if __name__ == '__main__':
+    sys.exit(main())